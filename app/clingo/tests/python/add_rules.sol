@@ -0,0 +1,5 @@
+Step: 1
+a c
+a c d
+b
+SAT
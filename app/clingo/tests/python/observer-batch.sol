@@ -0,0 +1,8 @@
+Step: 1
+
+a b
+a c
+b
+Step: 2
+batched choice(a) choice(b) head(c) head(e) kept
+SAT
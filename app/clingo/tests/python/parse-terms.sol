@@ -0,0 +1,3 @@
+Step: 1
+p("s") p((a,2)) p(-p(1)) p(-p) p(1) p(p(3))
+SAT
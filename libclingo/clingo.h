@@ -491,6 +491,23 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_add_string(char const *string, char const
 //! - ::clingo_error_bad_alloc
 //! - ::clingo_error_runtime if parsing fails
 CLINGO_VISIBILITY_DEFAULT bool clingo_parse_term(char const *string, clingo_logger_t logger, void *logger_data, unsigned message_limit, clingo_symbol_t *symbol);
+//! Parse an array of terms in string form.
+//!
+//! Behaves like calling clingo_parse_term() for each string but reuses the
+//! same parser for all of them.  Simple terms like numbers, constants,
+//! strings, and flat functions or tuples over these are parsed without
+//! invoking the full term grammar.
+//!
+//! @param[in] strings the strings to parse
+//! @param[in] size the number of strings
+//! @param[in] logger optional logger to report warnings during parsing
+//! @param[in] logger_data user data for the logger
+//! @param[in] message_limit maximum number of times to call the logger
+//! @param[out] symbols the resulting symbols (an array of length size)
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if parsing one of the strings fails
+CLINGO_VISIBILITY_DEFAULT bool clingo_parse_terms(char const * const *strings, size_t size, clingo_logger_t logger, void *logger_data, unsigned message_limit, clingo_symbol_t *symbols);
 
 //! @}
 
@@ -998,6 +1015,39 @@ CLINGO_VISIBILITY_DEFAULT size_t clingo_assignment_max_size(clingo_assignment_t
 //! @param[in] assignment the target
 //! @return wheather the assignment is total
 CLINGO_VISIBILITY_DEFAULT bool clingo_assignment_is_total(clingo_assignment_t *assignment);
+//! The number of literals on the trail of the assignment.
+//!
+//! The trail holds the assigned literals in the order they were assigned.
+//! Literals assigned on decision level zero are at the beginning of the trail.
+//!
+//! @param[in] assignment the target
+//! @param[out] size the number of literals on the trail
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_assignment_trail_size(clingo_assignment_t *assignment, uint32_t *size);
+//! Get the literal at the given position of the trail.
+//!
+//! @param[in] assignment the target
+//! @param[in] offset the position on the trail
+//! @param[out] literal the literal
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the offset is not smaller than the size of the trail
+CLINGO_VISIBILITY_DEFAULT bool clingo_assignment_trail_at(clingo_assignment_t *assignment, uint32_t offset, clingo_literal_t *literal);
+//! Get the position on the trail where the given decision level starts.
+//!
+//! @param[in] assignment the target
+//! @param[in] level the decision level
+//! @param[out] offset the position of the first literal assigned on the level
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the level is greater than the current decision level
+CLINGO_VISIBILITY_DEFAULT bool clingo_assignment_trail_begin(clingo_assignment_t *assignment, uint32_t level, uint32_t *offset);
+//! Get the position on the trail after the last literal assigned on the given decision level.
+//!
+//! @param[in] assignment the target
+//! @param[in] level the decision level
+//! @param[out] offset the position after the last literal assigned on the level
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_runtime if the level is greater than the current decision level
+CLINGO_VISIBILITY_DEFAULT bool clingo_assignment_trail_end(clingo_assignment_t *assignment, uint32_t level, uint32_t *offset);
 
 //! @}
 
@@ -1044,6 +1094,36 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watch(clingo_propagate_
 //! @param[in] thread_id the id of the solver thread
 //! @return whether the call was successful
 CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watch_to_thread(clingo_propagate_init_t *init, clingo_literal_t solver_literal, uint32_t thread_id);
+//! Map the given program literals or condition ids to their solver literals.
+//!
+//! This is equivalent to calling clingo_propagate_init_solver_literal() for each literal
+//! but avoids the per literal call overhead when mapping large numbers of literals.
+//!
+//! @param[in] init the target
+//! @param[in] aspif_literals the aspif literals to map
+//! @param[in] size the number of literals
+//! @param[out] solver_literals the resulting solver literals (an array of the given size)
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_solver_literals(clingo_propagate_init_t *init, clingo_literal_t const *aspif_literals, size_t size, clingo_literal_t *solver_literals);
+//! Add watches for the given solver literals.
+//!
+//! This is equivalent to calling clingo_propagate_init_add_watch() for each literal.
+//!
+//! @param[in] init the target
+//! @param[in] solver_literals the solver literals
+//! @param[in] size the number of literals
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watches(clingo_propagate_init_t *init, clingo_literal_t const *solver_literals, size_t size);
+//! Add watches for the given solver literals to the given solver thread.
+//!
+//! This is equivalent to calling clingo_propagate_init_add_watch_to_thread() for each literal.
+//!
+//! @param[in] init the target
+//! @param[in] solver_literals the solver literals
+//! @param[in] size the number of literals
+//! @param[in] thread_id the id of the solver thread
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_init_add_watches_to_thread(clingo_propagate_init_t *init, clingo_literal_t const *solver_literals, size_t size, uint32_t thread_id);
 //! Get an object to inspect the symbolic atoms.
 //!
 //! @param[in] init the target
@@ -1163,6 +1243,27 @@ CLINGO_VISIBILITY_DEFAULT void clingo_propagate_control_remove_watch(clingo_prop
 //! @return whether the call was successful; might set one of the following error codes:
 //! - ::clingo_error_bad_alloc
 CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_control_add_clause(clingo_propagate_control_t *control, clingo_literal_t const *clause, size_t size, clingo_clause_type_t type, bool *result);
+//! Add multiple clauses to the solver.
+//!
+//! The clauses are passed in a packed format.
+//! The i-th clause consists of the literals `literals[offsets[i]]`, ..., `literals[offsets[i+1]-1]`.
+//! Hence, the offset array has to contain `size + 1` non-decreasing elements.
+//!
+//! The clauses are added in turn as if by calling clingo_propagate_control_add_clause().
+//! As soon as adding a clause sets the result to false, the remaining clauses are not added.
+//!
+//! @attention No further calls on the control object or functions on the assignment should be called when the result of this method is false.
+//!
+//! @param[in] control the target
+//! @param[in] size the number of clauses
+//! @param[in] offsets the offsets of the clauses
+//! @param[in] literals the literals of all clauses
+//! @param[in] types optional array of length size determining the clause types (learnt if NULL)
+//! @param[out] result result indicating whether propagation has to be stopped
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_logic if the offsets are decreasing
+CLINGO_VISIBILITY_DEFAULT bool clingo_propagate_control_add_clauses(clingo_propagate_control_t *control, size_t size, size_t const *offsets, clingo_literal_t const *literals, clingo_clause_type_t const *types, bool *result);
 //! Propagate implied literals (resulting from added clauses).
 //!
 //! This method sets its result to false if the current propagation must be stopped for the solver to backtrack.
@@ -1361,6 +1462,26 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_backend_end(clingo_backend_t *backend);
 //! @return whether the call was successful; might set one of the following error codes:
 //! - ::clingo_error_bad_alloc
 CLINGO_VISIBILITY_DEFAULT bool clingo_backend_rule(clingo_backend_t *backend, bool choice, clingo_atom_t const *head, size_t head_size, clingo_literal_t const *body, size_t body_size);
+//! Add multiple rules to the program.
+//!
+//! The rules are passed in a packed format.
+//! The head of the i-th rule consists of the atoms `heads[head_offsets[i]]`, ..., `heads[head_offsets[i+1]-1]`
+//! and its body of the literals `bodies[body_offsets[i]]`, ..., `bodies[body_offsets[i+1]-1]`.
+//! Hence, both offset arrays have to contain `size + 1` non-decreasing elements.
+//!
+//! The result is the same as calling clingo_backend_rule() for each rule in turn.
+//!
+//! @param[in] backend the target backend
+//! @param[in] choices optional array of length size determining whether a rule is a choice (disjunctive if NULL)
+//! @param[in] size the number of rules
+//! @param[in] head_offsets the offsets of the heads
+//! @param[in] heads the head atoms of all rules
+//! @param[in] body_offsets the offsets of the bodies
+//! @param[in] bodies the body literals of all rules
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_logic if the offsets are decreasing
+CLINGO_VISIBILITY_DEFAULT bool clingo_backend_rules(clingo_backend_t *backend, bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, size_t const *body_offsets, clingo_literal_t const *bodies);
 //! Add a weight rule to the program.
 //!
 //! @attention All weights and the lower bound must be positive.
@@ -2081,6 +2202,33 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_solve_handle_get(clingo_solve_handle_t *ha
 //! @param[in] timeout the maximum time to wait
 //! @param[out] result whether the search has finished
 CLINGO_VISIBILITY_DEFAULT void clingo_solve_handle_wait(clingo_solve_handle_t *handle, double timeout, bool *result);
+//! Get the next solve result if it is ready without blocking.
+//!
+//! If the result is not yet ready, ready is set to false and result is left untouched.
+//! Otherwise, this function behaves like clingo_solve_handle_get().
+//!
+//! @param[in] handle the target
+//! @param[out] result the solve result
+//! @param[out] ready whether the result was ready
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if solving fails
+CLINGO_VISIBILITY_DEFAULT bool clingo_solve_handle_try_get(clingo_solve_handle_t *handle, clingo_solve_result_bitset_t *result, bool *ready);
+//! Get a file descriptor that becomes readable whenever the next result is ready.
+//!
+//! The descriptor can be monitored with select, poll, or epoll to multiplex many asynchronous searches in one thread.
+//! It becomes readable when a model is found (when yielding models) or when the search has finished
+//! and stays readable until the result has been retrieved with clingo_solve_handle_try_get().
+//! The descriptor is owned by the handle and must neither be read from nor closed by the caller.
+//!
+//! @note This function is not available on windows.
+//!
+//! @param[in] handle the target
+//! @param[out] fd the file descriptor
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if the descriptor could not be created
+CLINGO_VISIBILITY_DEFAULT bool clingo_solve_handle_notifier(clingo_solve_handle_t *handle, int *fd);
 //! Get the next model (or zero if there are no more models).
 //!
 //! @param[in] handle the target
@@ -2985,6 +3133,68 @@ typedef struct clingo_ground_program_observer {
     bool (*theory_atom_with_guard)(clingo_id_t atom_id_or_zero, clingo_id_t term_id, clingo_id_t const *elements, size_t size, clingo_id_t operator_id, clingo_id_t right_hand_side_id, void *data);
 } clingo_ground_program_observer_t;
 
+//! An instance of this struct can be registered together with a @ref clingo_ground_program_observer_t to observe statements in batches.
+//!
+//! Statements for which a batch callback is set are collected and passed in packed arrays.
+//! All other statements are passed to the callbacks of the regular observer.
+//! The i-th statement of a batch is described by the elements between `offsets[i]` and `offsets[i+1]` of the respective arrays.
+//! Hence, offset arrays contain `size + 1` elements.
+//!
+//! A batch is passed on as soon as it holds the configured number of statements,
+//! before any callback of the regular observer is called, and at the end of a step.
+//! Thus, the order of statements is preserved except among statements of different batched kinds.
+//!
+//! @note The arrays are only valid during the callback.
+//!
+//! Not all callbacks have to be implemented and can be set to NULL if not needed.
+//! Error handling is the same as for @ref clingo_ground_program_observer_t.
+//!
+//! @see clingo_control_register_batch_observer()
+typedef struct clingo_ground_program_batch_observer {
+    //! Observe a batch of rules passed to the solver.
+    //!
+    //! @param[in] choices whether the head of the i-th rule is a choice or a disjunction
+    //! @param[in] size the number of rules
+    //! @param[in] head_offsets the offsets of the heads
+    //! @param[in] heads the head atoms of all rules
+    //! @param[in] body_offsets the offsets of the bodies
+    //! @param[in] bodies the body literals of all rules
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*rules)(bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, size_t const *body_offsets, clingo_literal_t const *bodies, void *data);
+    //! Observe a batch of weight rules passed to the solver.
+    //!
+    //! @param[in] choices whether the head of the i-th rule is a choice or a disjunction
+    //! @param[in] size the number of rules
+    //! @param[in] head_offsets the offsets of the heads
+    //! @param[in] heads the head atoms of all rules
+    //! @param[in] lower_bounds the lower bounds of the rules
+    //! @param[in] body_offsets the offsets of the bodies
+    //! @param[in] bodies the weighted body literals of all rules
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*weight_rules)(bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, clingo_weight_t const *lower_bounds, size_t const *body_offsets, clingo_weighted_literal_t const *bodies, void *data);
+    //! Observe a batch of shown atoms passed to the solver.
+    //!
+    //! @param[in] symbols the symbolic representations of the atoms
+    //! @param[in] atoms the associated program atoms (zero for facts)
+    //! @param[in] size the number of atoms
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*output_atoms)(clingo_symbol_t const *symbols, clingo_atom_t const *atoms, size_t size, void *data);
+    //! Observe a batch of theory elements.
+    //!
+    //! @param[in] element_ids the ids of the elements
+    //! @param[in] size the number of elements
+    //! @param[in] term_offsets the offsets of the term tuples
+    //! @param[in] terms the term ids of all elements
+    //! @param[in] condition_offsets the offsets of the conditions
+    //! @param[in] conditions the condition literals of all elements
+    //! @param[in] data user data for the callback
+    //! @return whether the call was successful
+    bool (*theory_elements)(clingo_id_t const *element_ids, size_t size, size_t const *term_offsets, clingo_id_t const *terms, size_t const *condition_offsets, clingo_literal_t const *conditions, void *data);
+} clingo_ground_program_batch_observer_t;
+
 // @}
 
 // {{{1 control
@@ -3119,6 +3329,47 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_new(char const *const * arguments,
 //! @param[in] control the target
 CLINGO_VISIBILITY_DEFAULT void clingo_control_free(clingo_control_t *control);
 
+//! Object holding preprocessed command line arguments to create control objects.
+typedef struct clingo_control_template clingo_control_template_t;
+
+//! Create a template to cheaply create many control objects with the same arguments.
+//!
+//! The arguments are parsed once and the resulting configuration is stored in the template.
+//! Creating a control object with clingo_control_new_from_template() then skips argument parsing.
+//! A template is not modified after its creation and can be used from multiple threads at the same time.
+//!
+//! A template has to be freed using clingo_control_template_free().
+//!
+//! @param[in] arguments C string array of command line arguments
+//! @param[in] arguments_size size of the arguments array
+//! @param[out] tpl resulting template
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if argument parsing fails
+//! @see clingo_control_new()
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_template_new(char const *const * arguments, size_t arguments_size, clingo_control_template_t **tpl);
+
+//! Free a template created with clingo_control_template_new().
+//!
+//! Control objects created from the template are not affected.
+//! @param[in] tpl the target
+CLINGO_VISIBILITY_DEFAULT void clingo_control_template_free(clingo_control_template_t *tpl);
+
+//! Create a new control object from a template.
+//!
+//! The control object behaves as if it had been created with clingo_control_new() passing the arguments of the template.
+//! It has to be freed using clingo_control_free().
+//!
+//! @param[in] tpl the template
+//! @param[in] logger callback functions for warnings and info messages
+//! @param[in] logger_data user data for the logger callback
+//! @param[in] message_limit maximum number of times the logger callback is called
+//! @param[out] control resulting control object
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_new_from_template(clingo_control_template_t const *tpl, clingo_logger_t logger, void *logger_data, unsigned message_limit, clingo_control_t **control);
+
 //! @name Grounding Functions
 //! @{
 
@@ -3361,6 +3612,19 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_theory_atoms(clingo_control_t *con
 //! @param[in] data user data passed to the observer functions
 //! @return whether the call was successful
 CLINGO_VISIBILITY_DEFAULT bool clingo_control_register_observer(clingo_control_t *control, clingo_ground_program_observer_t const *observer, bool replace, void *data);
+//! Register a program observer that receives statements in batches.
+//!
+//! @param[in] control the target
+//! @param[in] observer the observer for statements that are not batched
+//! @param[in] batch_observer the observer for batched statements
+//! @param[in] batch_size the maximum number of statements in a batch
+//! @param[in] replace just pass the grounding to the observer but not the solver
+//! @param[in] data user data passed to the observer functions
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_logic if the batch size is zero
+//! @see clingo_ground_program_batch_observer_t
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_register_batch_observer(clingo_control_t *control, clingo_ground_program_observer_t const *observer, clingo_ground_program_batch_observer_t const *batch_observer, size_t batch_size, bool replace, void *data);
 //! @}
 
 //! @name Program Modification Functions
@@ -805,6 +805,10 @@ public:
     size_t size() const;
     size_t max_size() const;
     bool is_total() const;
+    uint32_t trail_size() const;
+    literal_t trail_at(uint32_t offset) const;
+    uint32_t trail_begin(uint32_t level) const;
+    uint32_t trail_end(uint32_t level) const;
     clingo_assignment_t *to_c() const { return ass_; }
 private:
     clingo_assignment_t *ass_;
@@ -825,6 +829,9 @@ public:
     literal_t solver_literal(literal_t lit) const;
     void add_watch(literal_t lit);
     void add_watch(literal_t literal, id_t thread_id);
+    std::vector<literal_t> solver_literals(LiteralSpan lits) const;
+    void add_watches(LiteralSpan lits);
+    void add_watches(LiteralSpan lits, id_t thread_id);
     int number_of_threads() const;
     Assignment assignment() const;
     SymbolicAtoms symbolic_atoms() const;
@@ -866,6 +873,7 @@ public:
     bool has_watch(literal_t literal) const;
     void remove_watch(literal_t literal);
     bool add_clause(LiteralSpan clause, ClauseType type = ClauseType::Learnt);
+    bool add_clauses(Span<size_t> offsets, LiteralSpan literals, Span<ClauseType> types = {});
     bool propagate();
     clingo_propagate_control_t *to_c() const { return ctl_; }
 private:
@@ -1756,6 +1764,7 @@ class Backend {
 public:
     explicit Backend(clingo_backend_t *backend);
     void rule(bool choice, AtomSpan head, LiteralSpan body);
+    void rules(Span<bool> choices, Span<size_t> head_offsets, AtomSpan heads, Span<size_t> body_offsets, LiteralSpan bodies);
     void weight_rule(bool choice, AtomSpan head, weight_t lower, WeightedLiteralSpan body);
     void minimize(weight_t prio, WeightedLiteralSpan body);
     void project(AtomSpan atoms);
@@ -1941,6 +1950,8 @@ public:
     Model const &model();
     Model const &next();
     SolveResult get();
+    bool try_get(SolveResult &result);
+    int notifier();
     void cancel();
     ~SolveHandle();
 private:
@@ -2083,7 +2094,24 @@ inline std::ostream &operator<<(std::ostream &out, WarningCode code) {
     return out;
 }
 
+class Control;
+
+class ControlTemplate {
+public:
+    explicit ControlTemplate(StringSpan args = {});
+    ControlTemplate(ControlTemplate &&tpl);
+    ControlTemplate(ControlTemplate const &) = delete;
+    ControlTemplate &operator=(ControlTemplate &&tpl);
+    ControlTemplate &operator=(ControlTemplate const &) = delete;
+    Control create_control(Logger logger = nullptr, unsigned message_limit = 20) const;
+    clingo_control_template_t const *to_c() const { return tpl_; }
+    ~ControlTemplate() noexcept;
+private:
+    clingo_control_template_t *tpl_;
+};
+
 class Control {
+    friend class ControlTemplate;
     struct Impl;
 public:
     Control(StringSpan args = {}, Logger logger = nullptr, unsigned message_limit = 20);
@@ -2166,6 +2194,7 @@ using StatementCallback = std::function<void (AST::Statement &&)>;
 
 void parse_program(char const *program, StatementCallback cb, Logger logger = nullptr, unsigned message_limit = 20);
 Symbol parse_term(char const *str, Logger logger = nullptr, unsigned message_limit = 20);
+SymbolVector parse_terms(StringSpan strs, Logger logger = nullptr, unsigned message_limit = 20);
 char const *add_string(char const *str);
 std::tuple<int, int, int> version();
 
@@ -2673,6 +2702,30 @@ inline bool Assignment::is_total() const {
     return clingo_assignment_is_total(ass_);
 }
 
+inline uint32_t Assignment::trail_size() const {
+    uint32_t ret;
+    Detail::handle_error(clingo_assignment_trail_size(ass_, &ret));
+    return ret;
+}
+
+inline literal_t Assignment::trail_at(uint32_t offset) const {
+    literal_t ret;
+    Detail::handle_error(clingo_assignment_trail_at(ass_, offset, &ret));
+    return ret;
+}
+
+inline uint32_t Assignment::trail_begin(uint32_t level) const {
+    uint32_t ret;
+    Detail::handle_error(clingo_assignment_trail_begin(ass_, level, &ret));
+    return ret;
+}
+
+inline uint32_t Assignment::trail_end(uint32_t level) const {
+    uint32_t ret;
+    Detail::handle_error(clingo_assignment_trail_end(ass_, level, &ret));
+    return ret;
+}
+
 // {{{2 propagate init
 
 inline literal_t PropagateInit::solver_literal(literal_t lit) const {
@@ -2689,6 +2742,20 @@ inline void PropagateInit::add_watch(literal_t lit, id_t thread_id) {
     Detail::handle_error(clingo_propagate_init_add_watch_to_thread(init_, lit, thread_id));
 }
 
+inline std::vector<literal_t> PropagateInit::solver_literals(LiteralSpan lits) const {
+    std::vector<literal_t> ret(lits.size());
+    Detail::handle_error(clingo_propagate_init_solver_literals(init_, lits.begin(), lits.size(), ret.data()));
+    return ret;
+}
+
+inline void PropagateInit::add_watches(LiteralSpan lits) {
+    Detail::handle_error(clingo_propagate_init_add_watches(init_, lits.begin(), lits.size()));
+}
+
+inline void PropagateInit::add_watches(LiteralSpan lits, id_t thread_id) {
+    Detail::handle_error(clingo_propagate_init_add_watches_to_thread(init_, lits.begin(), lits.size(), thread_id));
+}
+
 inline int PropagateInit::number_of_threads() const {
     return clingo_propagate_init_number_of_threads(init_);
 }
@@ -2751,6 +2818,19 @@ inline bool PropagateControl::add_clause(LiteralSpan clause, ClauseType type) {
     return ret;
 }
 
+inline bool PropagateControl::add_clauses(Span<size_t> offsets, LiteralSpan literals, Span<ClauseType> types) {
+    size_t size = offsets.empty() ? 0 : offsets.size() - 1;
+    if (!types.empty() && types.size() != size) {
+        throw std::invalid_argument("sizes of offsets and types do not match");
+    }
+    if (size > 0 && offsets.begin()[size] > literals.size()) {
+        throw std::invalid_argument("offsets out of range");
+    }
+    bool ret;
+    Detail::handle_error(clingo_propagate_control_add_clauses(ctl_, size, offsets.begin(), literals.begin(), types.empty() ? nullptr : reinterpret_cast<clingo_clause_type_t const *>(types.begin()), &ret));
+    return ret;
+}
+
 inline bool PropagateControl::propagate() {
     bool ret;
     Detail::handle_error(clingo_propagate_control_propagate(ctl_, &ret));
@@ -2918,6 +2998,20 @@ inline SolveResult SolveHandle::get() {
     return SolveResult{ret};
 }
 
+inline bool SolveHandle::try_get(SolveResult &result) {
+    clingo_solve_result_bitset_t ret = 0;
+    bool ready = false;
+    Detail::handle_error(clingo_solve_handle_try_get(iter_, &ret, &ready), *exception_);
+    if (ready) { result = SolveResult{ret}; }
+    return ready;
+}
+
+inline int SolveHandle::notifier() {
+    int fd = -1;
+    Detail::handle_error(clingo_solve_handle_notifier(iter_, &fd), *exception_);
+    return fd;
+}
+
 inline void SolveHandle::cancel() {
     Detail::handle_error(clingo_solve_handle_close(iter_), *exception_);
 }
@@ -2941,6 +3035,17 @@ inline void Backend::rule(bool choice, AtomSpan head, LiteralSpan body) {
     Detail::handle_error(clingo_backend_rule(backend_, choice, head.begin(), head.size(), body.begin(), body.size()));
 }
 
+inline void Backend::rules(Span<bool> choices, Span<size_t> head_offsets, AtomSpan heads, Span<size_t> body_offsets, LiteralSpan bodies) {
+    size_t size = head_offsets.empty() ? 0 : head_offsets.size() - 1;
+    if (body_offsets.size() != head_offsets.size() || (!choices.empty() && choices.size() != size)) {
+        throw std::invalid_argument("sizes of offsets and choices do not match");
+    }
+    if (size > 0 && (head_offsets.begin()[size] > heads.size() || body_offsets.begin()[size] > bodies.size())) {
+        throw std::invalid_argument("offsets out of range");
+    }
+    Detail::handle_error(clingo_backend_rules(backend_, choices.empty() ? nullptr : choices.begin(), size, head_offsets.begin(), heads.begin(), body_offsets.begin(), bodies.begin()));
+}
+
 inline void Backend::weight_rule(bool choice, AtomSpan head, weight_t lower, WeightedLiteralSpan body) {
     Detail::handle_error(clingo_backend_weight_rule(backend_, choice, head.begin(), head.size(), lower, reinterpret_cast<clingo_weighted_literal_t const *>(body.begin()), body.size()));
 }
@@ -3802,6 +3907,22 @@ inline void ProgramBuilder::end() {
 
 // {{{2 control
 
+inline ControlTemplate::ControlTemplate(StringSpan args)
+: tpl_(nullptr) {
+    Detail::handle_error(clingo_control_template_new(args.begin(), args.size(), &tpl_));
+}
+
+inline ControlTemplate::ControlTemplate(ControlTemplate &&tpl)
+: tpl_(nullptr) {
+    std::swap(tpl_, tpl.tpl_);
+}
+
+inline ControlTemplate &ControlTemplate::operator=(ControlTemplate &&tpl) {
+    std::swap(tpl_, tpl.tpl_);
+    return *this;
+}
+
+
 struct Control::Impl {
     Impl(Logger logger)
     : ctl(nullptr)
@@ -3838,6 +3959,21 @@ inline Clingo::Control::Control(StringSpan args, Logger logger, unsigned message
 inline Control::Control(clingo_control_t *ctl, bool owns)
     : impl_(new Impl(ctl, owns)) { }
 
+inline Control ControlTemplate::create_control(Logger logger, unsigned message_limit) const {
+    Control ctl{static_cast<clingo_control_t*>(nullptr), true};
+    ctl.impl_->logger = logger;
+    clingo_logger_t f = [](clingo_warning_t code, char const *msg, void *data) {
+        try { (*static_cast<Logger*>(data))(static_cast<WarningCode>(code), msg); }
+        catch (...) { }
+    };
+    Detail::handle_error(clingo_control_new_from_template(tpl_, logger ? f : nullptr, logger ? &ctl.impl_->logger : nullptr, message_limit, &ctl.impl_->ctl));
+    return ctl;
+}
+
+inline ControlTemplate::~ControlTemplate() noexcept {
+    if (tpl_) { clingo_control_template_free(tpl_); }
+}
+
 inline Control::Control(Control &&c)
     : impl_(nullptr) {
     std::swap(impl_, c.impl_);
@@ -4355,6 +4491,15 @@ inline Symbol parse_term(char const *str, Logger logger, unsigned message_limit)
     return Symbol(ret);
 }
 
+inline SymbolVector parse_terms(StringSpan strs, Logger logger, unsigned message_limit) {
+    SymbolVector ret(strs.size());
+    Detail::handle_error(clingo_parse_terms(strs.begin(), strs.size(), [](clingo_warning_t code, char const *msg, void *data) {
+        try { (*static_cast<Logger*>(data))(static_cast<WarningCode>(code), msg); }
+        catch (...) { }
+    }, &logger, message_limit, reinterpret_cast<clingo_symbol_t *>(ret.data())));
+    return ret;
+}
+
 inline char const *add_string(char const *str) {
     char const *ret;
     Detail::handle_error(clingo_add_string(str, &ret));
@@ -78,6 +78,7 @@ public:
 private:
     Clasp::Asp::LogicProgram *prg();
     ClingoControl& ctl_;
+    std::string    buffer_;
 };
 
 // {{{1 declaration of ClingoOptions
@@ -94,8 +95,10 @@ struct ClingoOptions {
     bool                          wNoVariableUnbounded  = false;
     bool                          wNoGlobalVariable     = false;
     bool                          wNoOther              = false;
+    bool                          warnRepeated          = false;
     bool                          rewriteMinimize       = false;
     bool                          keepFacts             = false;
+    bool                          explainGrounding      = false;
     Foobar                        foobar;
 };
 
@@ -163,6 +166,9 @@ public:
     int threads() override;
     void addWatch(Lit_t lit) override { p_.addWatch(Clasp::decodeLit(lit)); }
     void addWatch(uint32_t solverId, Lit_t lit) override { p_.addWatch(solverId, Clasp::decodeLit(lit)); }
+    void mapLits(Lit_t const *lits, size_t size, Lit_t *ret) override;
+    void addWatches(Lit_t const *lits, size_t size) override;
+    void addWatches(uint32_t solverId, Lit_t const *lits, size_t size) override;
     void enableHistory(bool b) override { p_.enableHistory(b); };
     void setCheckMode(clingo_propagator_check_mode_t checkMode) override {
         p_.enableClingoPropagatorCheck(static_cast<Clasp::ClingoPropagatorCheck_t::Type>(checkMode));
@@ -286,12 +292,16 @@ public:
     ClingoControl(Scripts &scripts, bool clingoMode, Clasp::ClaspFacade *clasp, Clasp::Cli::ClaspCliConfig &claspConfig, PostGroundFunc pgf, PreSolveFunc psf, Logger::Printer printer, unsigned messageLimit);
     ~ClingoControl() noexcept override;
     void prepare(Assumptions ass);
+    // Adds the lookup statistics of the grounder to the statistics tree.
+    void updateGrounderStatistics();
     void commitExternals();
     void parse();
     void parse(const StringVec& files, const ClingoOptions& opts, Clasp::Asp::LogicProgram* out, bool addStdIn = true);
     void main(IClingoApp &app, StringVec const &files, const ClingoOptions& opts, Clasp::Asp::LogicProgram* out);
     bool onModel(Clasp::Model const &m);
     void onFinish(Clasp::ClaspFacade::Result ret);
+    void setNotifier(EventNotifier *notifier, bool models);
+    void notify(bool model);
     bool update();
 
     virtual void postGround(Clasp::ProgramBuilder& prg) {
@@ -379,6 +389,9 @@ public:
     std::unique_ptr<Input::NongroundProgramBuilder>            pb_;
     std::unique_ptr<Input::NonGroundParser>                    parser_;
     USolveEventHandler                                         eventHandler_;
+    std::mutex                                                 notifierMut_;
+    EventNotifier                                             *notifier_              = nullptr;
+    bool                                                       notifyModels_          = false;
     Clasp::ClaspFacade                                        *clasp_                 = nullptr;
     Clasp::Cli::ClaspCliConfig                                &claspConfig_;
     PostGroundFunc                                             pgf_;
@@ -395,6 +408,7 @@ public:
     bool                                                       enableEnumAssupmption_ = true;
     bool                                                       clingoMode_;
     bool                                                       verbose_               = false;
+    bool                                                       explainGrounding_      = false;
     bool                                                       parsed                 = false;
     bool                                                       grounded               = false;
     bool                                                       incremental_           = true;
@@ -471,16 +485,44 @@ public:
     bool wait(double timeout) override;
     void resume() override;
     void cancel() override;
+    int notifier() override;
+    bool tryGet(SolveResult &ret) override;
+    ~ClingoSolveFuture() override;
 private:
     ClingoModel                     model_;
     Clasp::ClaspFacade::SolveHandle handle_;
+    UEventNotifier                  notifier_;
+    bool                            yield_;
+};
+
+// {{{1 declaration of ClingoLibTemplate
+
+// Stores the gringo options and the values of the clasp configuration
+// resulting from parsing a set of command line arguments. Instantiating a
+// ClingoLib from a template replays the stored configuration values instead
+// of parsing options again. Templates are immutable after construction and
+// can be shared between threads.
+class ClingoLibTemplate {
+public:
+    ClingoLibTemplate(Scripts &scripts, int argc, char const * const *argv);
+private:
+    friend class ClingoLib;
+    void record(Clasp::Cli::ClaspCliConfig &config, unsigned key);
+    void apply(Clasp::Cli::ClaspCliConfig &config) const;
+
+    ClingoOptions                               grOpts_;
+    Potassco::ProgramOptions::ParsedOptions     parsed_;
+    std::vector<std::pair<unsigned, unsigned>>  arrays_;
+    std::vector<std::pair<unsigned, std::string>> values_;
 };
 
 // {{{1 declaration of ClingoLib
 
 class ClingoLib : public Clasp::EventHandler, public ClingoControl {
+    friend class ClingoLibTemplate;
 public:
     ClingoLib(Scripts &scripts, int argc, char const * const *argv, Logger::Printer printer, unsigned messageLimit);
+    ClingoLib(Scripts &scripts, ClingoLibTemplate const &tpl, Logger::Printer printer, unsigned messageLimit);
     ~ClingoLib() override;
 protected:
     void initOptions(Potassco::ProgramOptions::OptionContext& root);
@@ -490,6 +532,7 @@ protected:
     void onEvent(const Clasp::Event& ev) override;
     bool onModel(const Clasp::Solver& s, const Clasp::Model& m) override;
 private:
+    ClingoLib(Scripts &scripts, int argc, char const * const *argv, Logger::Printer printer, unsigned messageLimit, ClingoLibTemplate *tpl);
     ClingoLib(const ClingoLib&);
     ClingoLib& operator=(const ClingoLib&);
     ClingoOptions                       grOpts_;
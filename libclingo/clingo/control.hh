@@ -118,6 +118,25 @@ struct clingo_model {
 
 namespace Gringo {
 
+// {{{1 declaration of EventNotifier
+
+// A file descriptor that becomes readable when notified and stays readable
+// until cleared; an eventfd on linux and a pipe on other posix systems.
+class EventNotifier {
+public:
+    EventNotifier();
+    EventNotifier(EventNotifier const &) = delete;
+    EventNotifier &operator=(EventNotifier const &) = delete;
+    ~EventNotifier() noexcept;
+    int fd() const { return read_; }
+    void notify();
+    void clear();
+private:
+    int read_ = -1;
+    int write_ = -1;
+};
+using UEventNotifier = std::unique_ptr<EventNotifier>;
+
 // {{{1 declaration of SolveFuture
 
 struct SolveEventHandler {
@@ -135,6 +154,10 @@ struct SolveFuture {
     virtual bool wait(double timeout) = 0;
     virtual void cancel() = 0;
     virtual void resume() = 0;
+    // returns a descriptor that becomes readable when the next result is ready
+    virtual int notifier() = 0;
+    // retrieves the next result if it is ready without blocking
+    virtual bool tryGet(SolveResult &ret) = 0;
     virtual ~SolveFuture() { }
 };
 using USolveFuture = std::unique_ptr<SolveFuture>;
@@ -145,6 +168,18 @@ struct DefaultSolveFuture : SolveFuture {
     Model const *model() override { resume(); return nullptr; }
     bool wait(double) override { resume(); return true; }
     void cancel() override { resume(); }
+    int notifier() override {
+        if (!notifier_) {
+            notifier_ = gringo_make_unique<EventNotifier>();
+            notifier_->notify();
+        }
+        return notifier_->fd();
+    }
+    bool tryGet(SolveResult &ret) override {
+        if (notifier_) { notifier_->clear(); }
+        ret = get();
+        return true;
+    }
     void resume() override {
         if (!done_) {
             done_ = true;
@@ -155,6 +190,7 @@ struct DefaultSolveFuture : SolveFuture {
     ~DefaultSolveFuture() override { resume(); }
 private:
     USolveEventHandler cb_;
+    UEventNotifier notifier_;
     bool done_ = false;
 };
 
@@ -185,6 +221,9 @@ struct clingo_propagate_init {
     virtual Gringo::Lit_t mapLit(Gringo::Lit_t lit) = 0;
     virtual void addWatch(Gringo::Lit_t lit) = 0;
     virtual void addWatch(uint32_t solverId, Gringo::Lit_t lit) = 0;
+    virtual void mapLits(Gringo::Lit_t const *lits, size_t size, Gringo::Lit_t *ret) = 0;
+    virtual void addWatches(Gringo::Lit_t const *lits, size_t size) = 0;
+    virtual void addWatches(uint32_t solverId, Gringo::Lit_t const *lits, size_t size) = 0;
     virtual void enableHistory(bool b) = 0;
     virtual Potassco::AbstractAssignment const &assignment() const = 0;
     virtual int threads() = 0;
@@ -57,12 +57,15 @@ void ClingoApp::initOptions(Potassco::ProgramOptions::OptionContext& root) {
           ("intermediate", Gringo::Output::OutputFormat::INTERMEDIATE)
           ("text", Gringo::Output::OutputFormat::TEXT)
           ("reify", Gringo::Output::OutputFormat::REIFY)
-          ("smodels", Gringo::Output::OutputFormat::SMODELS)), "Choose output format:\n"
+          ("smodels", Gringo::Output::OutputFormat::SMODELS)
+          ("count", Gringo::Output::OutputFormat::COUNT)), "Choose output format:\n"
              "      intermediate: print intermediate format\n"
              "      text        : print plain text format\n"
              "      reify       : print program as reified facts\n"
              "      smodels     : print smodels format\n"
-             "                    (only supports basic features)")
+             "                    (only supports basic features)\n"
+             "      count       : only print statistics about the\n"
+             "                    size of the ground program")
         ("output-debug,@1", storeTo(grOpts_.outputOptions.debug = Gringo::Output::OutputDebug::NONE, values<Gringo::Output::OutputDebug>()
           ("none", Gringo::Output::OutputDebug::NONE)
           ("text", Gringo::Output::OutputDebug::TEXT)
@@ -81,8 +84,12 @@ void ClingoApp::initOptions(Potassco::ProgramOptions::OptionContext& root) {
          "      [no-]variable-unbounded:  $x > 10.\n"
          "      [no-]global-variable:     :- #count { X } = 1, X = 1.\n"
          "      [no-]other:               clasp related and uncategorized warnings")
+        ("warn-repeated,@2"         , flag(grOpts_.warnRepeated = false), "Report every occurrence of a warning instead of\n"
+         "      summarizing repetitions at the same location")
         ("rewrite-minimize,@1"      , flag(grOpts_.rewriteMinimize = false), "Rewrite minimize constraints into rules")
         ("keep-facts,@1"            , flag(grOpts_.keepFacts = false), "Do not remove facts from normal rules")
+        ("explain-grounding,@2"     , flag(grOpts_.explainGrounding = false), "Print the join plan of each rule with estimated\n"
+         "      and actual bindings to stderr after grounding")
         ("reify-sccs,@1"            , flag(grOpts_.outputOptions.reifySCCs = false), "Calculate SCCs for reified output")
         ("reify-steps,@1"           , flag(grOpts_.outputOptions.reifySteps = false), "Add step numbers to reified output")
         ("foobar,@4"                , storeTo(grOpts_.foobar, parseFoobar) , "Foobar")
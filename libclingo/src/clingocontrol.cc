@@ -29,6 +29,13 @@
 #include <potassco/basic_types.h>
 #include "clingo.h"
 #include <signal.h>
+#if defined(__linux__)
+#   include <sys/eventfd.h>
+#   include <unistd.h>
+#elif !defined(_WIN32)
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
 #include <clingo/script.h>
 #include <clingo/incmode.hh>
 
@@ -59,21 +66,21 @@ void ClaspAPIBackend::project(const Potassco::AtomSpan& atoms) {
 }
 
 void ClaspAPIBackend::output(Symbol sym, Potassco::Atom_t atom) {
-    std::ostringstream out;
-    out << sym;
+    buffer_.clear();
+    sym.print(buffer_);
     if (atom != 0) {
         Potassco::Lit_t lit = atom;
-        if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), Potassco::LitSpan{&lit, 1}); }
+        if (auto p = prg()) { p->addOutput(Potassco::toSpan(buffer_.c_str()), Potassco::LitSpan{&lit, 1}); }
     }
     else {
-        if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), Potassco::LitSpan{nullptr, 0}); }
+        if (auto p = prg()) { p->addOutput(Potassco::toSpan(buffer_.c_str()), Potassco::LitSpan{nullptr, 0}); }
     }
 }
 
 void ClaspAPIBackend::output(Symbol sym, Potassco::LitSpan const& condition) {
-    std::ostringstream out;
-    out << sym;
-    if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), condition); }
+    buffer_.clear();
+    sym.print(buffer_);
+    if (auto p = prg()) { p->addOutput(Potassco::toSpan(buffer_.c_str()), condition); }
 }
 
 void ClaspAPIBackend::output(Symbol sym, int value, Potassco::LitSpan const& condition) {
@@ -163,6 +170,25 @@ Potassco::Lit_t ClingoPropagateInit::mapLit(Lit_t lit) {
     return Clasp::encodeLit(prg.getLiteral(lit, Clasp::Asp::MapLit_t::Refined));
 }
 
+void ClingoPropagateInit::mapLits(Lit_t const *lits, size_t size, Lit_t *ret) {
+    const auto& prg = static_cast<Clasp::Asp::LogicProgram&>(*static_cast<ClingoControl&>(c_).clasp_->program());
+    for (auto it = lits, ie = lits + size; it != ie; ++it, ++ret) {
+        *ret = Clasp::encodeLit(prg.getLiteral(*it, Clasp::Asp::MapLit_t::Refined));
+    }
+}
+
+void ClingoPropagateInit::addWatches(Lit_t const *lits, size_t size) {
+    for (auto it = lits, ie = lits + size; it != ie; ++it) {
+        p_.addWatch(Clasp::decodeLit(*it));
+    }
+}
+
+void ClingoPropagateInit::addWatches(uint32_t solverId, Lit_t const *lits, size_t size) {
+    for (auto it = lits, ie = lits + size; it != ie; ++it) {
+        p_.addWatch(solverId, Clasp::decodeLit(*it));
+    }
+}
+
 int ClingoPropagateInit::threads() {
     return static_cast<ClingoControl&>(c_).clasp_->ctx.concurrency();
 }
@@ -179,7 +205,9 @@ void ClingoControl::parse(const StringVec& files, const ClingoOptions& opts, Cla
     logger_.enable(Warnings::FileIncluded, !opts.wNoFileIncluded);
     logger_.enable(Warnings::GlobalVariable, !opts.wNoGlobalVariable);
     logger_.enable(Warnings::Other, !opts.wNoOther);
+    logger_.aggregate(!opts.warnRepeated);
     verbose_ = opts.verbose;
+    explainGrounding_ = opts.explainGrounding;
     Output::OutputPredicates outPreds;
     for (auto &x : opts.foobar) {
         outPreds.emplace_back(Location("<cmd>",1,1,"<cmd>", 1,1), x, false);
@@ -250,7 +278,8 @@ void ClingoControl::ground(Control::GroundVec const &parts, Context *context) {
         LOG << "************* grounded program *************" << std::endl;
         auto exit = onExit([this]{ scripts_.resetContext(); });
         if (context) { scripts_.setContext(*context); }
-        gPrg.ground(params, scripts_, *out_, logger_);
+        gPrg.ground(params, scripts_, *out_, logger_, explainGrounding_ ? &std::cerr : nullptr);
+        logger_.summarize();
     }
 }
 
@@ -289,6 +318,7 @@ bool ClingoControl::onModel(Clasp::Model const &m) {
         ClingoModel model(*this, &m);
         ret = eventHandler_->on_model(model);
     }
+    if (ret) { notify(true); }
     return ret;
 }
 void ClingoControl::onFinish(Clasp::ClaspFacade::Result ret) {
@@ -296,6 +326,16 @@ void ClingoControl::onFinish(Clasp::ClaspFacade::Result ret) {
         eventHandler_->on_finish(convert(ret), &step_stats_, &accu_stats_);
         eventHandler_ = nullptr;
     }
+    notify(false);
+}
+void ClingoControl::setNotifier(EventNotifier *notifier, bool models) {
+    std::lock_guard<decltype(notifierMut_)> lock(notifierMut_);
+    notifier_ = notifier;
+    notifyModels_ = models;
+}
+void ClingoControl::notify(bool model) {
+    std::lock_guard<decltype(notifierMut_)> lock(notifierMut_);
+    if (notifier_ && (!model || notifyModels_)) { notifier_->notify(); }
 }
 Symbol ClingoControl::getConst(std::string const &name) {
     auto ret = defs_.defs().find(name.c_str());
@@ -371,6 +411,7 @@ USolveFuture ClingoControl::solve(Assumptions ass, clingo_solve_mode_bitset_t mo
     if (clingoMode_) {
         static_assert(clingo_solve_mode_yield == static_cast<clingo_solve_mode_bitset_t>(Clasp::SolveMode_t::Yield), "");
         static_assert(clingo_solve_mode_async == static_cast<clingo_solve_mode_bitset_t>(Clasp::SolveMode_t::Async), "");
+        updateGrounderStatistics();
         if (cb) {
             step_stats_.init(statistics(), "user_step");
             accu_stats_.init(statistics(), "user_accu");
@@ -382,6 +423,16 @@ USolveFuture ClingoControl::solve(Assumptions ass, clingo_solve_mode_bitset_t mo
         return gringo_make_unique<DefaultSolveFuture>(std::move(cb));
     }
 }
+void ClingoControl::updateGrounderStatistics() {
+    using Potassco::Statistics_t;
+    auto *stats = statistics();
+    auto root = stats->add(stats->root(), "grounder", Statistics_t::Map);
+    // NOTE: the counters accumulate over all steps
+    auto filter = out_->data.filterStats();
+    stats->set(stats->add(root, "lookups", Statistics_t::Value), static_cast<double>(filter.lookups));
+    stats->set(stats->add(root, "filtered", Statistics_t::Value), static_cast<double>(filter.rejected));
+    stats->set(stats->add(root, "missed", Statistics_t::Value), static_cast<double>(filter.misses));
+}
 void ClingoControl::interrupt() {
     clasp_->interrupt(65);
 }
@@ -422,9 +473,8 @@ const char* TheoryOutput::first(const Clasp::Model&) {
 
 const char* TheoryOutput::next() {
     if (index_ < symbols_.size()) {
-        std::stringstream ss;
-        symbols_[index_].print(ss);
-        current_ = ss.str();
+        current_.clear();
+        symbols_[index_].print(current_);
         ++index_;
         return current_.c_str();
     }
@@ -666,7 +716,8 @@ SolveResult convert(Clasp::ClaspFacade::Result res) {
 
 ClingoSolveFuture::ClingoSolveFuture(ClingoControl &ctl, Clasp::SolveMode_t mode)
 : model_{ctl}
-, handle_{model_.context().clasp_->solve(mode)} { }
+, handle_{model_.context().clasp_->solve(mode)}
+, yield_{(static_cast<unsigned>(mode) & static_cast<unsigned>(Clasp::SolveMode_t::Yield)) != 0} { }
 
 SolveResult ClingoSolveFuture::get() {
     return convert(handle_.get());
@@ -689,10 +740,77 @@ void ClingoSolveFuture::cancel() {
 void ClingoSolveFuture::resume() {
     handle_.resume();
 }
+int ClingoSolveFuture::notifier() {
+    if (!notifier_) {
+        notifier_ = gringo_make_unique<EventNotifier>();
+        model_.context().setNotifier(notifier_.get(), yield_);
+        // the result might have become ready before the notifier was registered
+        if (handle_.ready()) { notifier_->notify(); }
+    }
+    return notifier_->fd();
+}
+bool ClingoSolveFuture::tryGet(SolveResult &ret) {
+    // the notifier is only cleared once the result is ready; this way it
+    // stays readable if an event is signaled before the handle is ready
+    if (!handle_.ready()) { return false; }
+    if (notifier_) { notifier_->clear(); }
+    ret = get();
+    return true;
+}
+ClingoSolveFuture::~ClingoSolveFuture() {
+    if (notifier_) { model_.context().setNotifier(nullptr, false); }
+}
+
+// {{{1 definition of EventNotifier
+
+EventNotifier::EventNotifier() {
+#if defined(__linux__)
+    read_ = write_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (read_ < 0) { throw std::runtime_error("could not create notification descriptor"); }
+#elif !defined(_WIN32)
+    int fds[2];
+    if (::pipe(fds) != 0) { throw std::runtime_error("could not create notification descriptor"); }
+    for (auto fd : fds) {
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    read_ = fds[0];
+    write_ = fds[1];
+#else
+    throw std::runtime_error("notification descriptors are not supported on this platform");
+#endif
+}
+EventNotifier::~EventNotifier() noexcept {
+#if !defined(_WIN32)
+    if (read_ >= 0) { ::close(read_); }
+    if (write_ >= 0 && write_ != read_) { ::close(write_); }
+#endif
+}
+void EventNotifier::notify() {
+    // a failing write means that the descriptor is already readable
+#if defined(__linux__)
+    uint64_t one = 1;
+    auto ret = ::write(write_, &one, sizeof(one));
+    static_cast<void>(ret);
+#elif !defined(_WIN32)
+    char one = 1;
+    auto ret = ::write(write_, &one, sizeof(one));
+    static_cast<void>(ret);
+#endif
+}
+void EventNotifier::clear() {
+#if !defined(_WIN32)
+    uint64_t buf[8];
+    while (::read(read_, buf, sizeof(buf)) > 0) { }
+#endif
+}
 
 // {{{1 definition of ClingoLib
 
 ClingoLib::ClingoLib(Scripts &scripts, int argc, char const * const *argv, Logger::Printer printer, unsigned messageLimit)
+        : ClingoLib(scripts, argc, argv, printer, messageLimit, nullptr) { }
+
+ClingoLib::ClingoLib(Scripts &scripts, int argc, char const * const *argv, Logger::Printer printer, unsigned messageLimit, ClingoLibTemplate *tpl)
         : ClingoControl(scripts, true, &clasp_, claspConfig_, nullptr, nullptr, printer, messageLimit) {
     using namespace Potassco::ProgramOptions;
     OptionContext allOpts("<libclingo>");
@@ -702,11 +820,23 @@ ClingoLib::ClingoLib(Scripts &scripts, int argc, char const * const *argv, Logge
     parsed.assign(values);
     allOpts.assignDefaults(parsed);
     claspConfig_.finalize(parsed, Clasp::Problem_t::Asp, true);
+    if (tpl) { tpl->parsed_ = parsed; }
     clasp_.ctx.setEventHandler(this);
     Clasp::Asp::LogicProgram* lp = &clasp_.startAsp(claspConfig_, true);
     parse({}, grOpts_, lp, false);
 }
 
+ClingoLib::ClingoLib(Scripts &scripts, ClingoLibTemplate const &tpl, Logger::Printer printer, unsigned messageLimit)
+        : ClingoControl(scripts, true, &clasp_, claspConfig_, nullptr, nullptr, printer, messageLimit)
+        , grOpts_(tpl.grOpts_) {
+    tpl.apply(claspConfig_);
+    // NOTE: passing the explicitly given options makes sure that defaults
+    //       and configuration presets do not overwrite the replayed values
+    claspConfig_.finalize(tpl.parsed_, Clasp::Problem_t::Asp, true);
+    clasp_.ctx.setEventHandler(this);
+    Clasp::Asp::LogicProgram* lp = &clasp_.startAsp(claspConfig_, true);
+    parse({}, grOpts_, lp, false);
+}
 
 static bool parseConst(const std::string& str, std::vector<std::string>& out) {
     out.push_back(str);
@@ -739,8 +869,14 @@ void ClingoLib::initOptions(Potassco::ProgramOptions::OptionContext& root) {
          "      [no-]variable-unbounded:  $x > 10.\n"
          "      [no-]global-variable:     :- #count { X } = 1, X = 1.\n"
          "      [no-]other:               clasp related and uncategorized warnings")
+        // NOTE: unlike the applications, library users get every occurrence of a warning by default
+        ("warn-repeated"            , flag(grOpts_.warnRepeated = true), "Report every occurrence of a warning instead of\n"
+         "      summarizing repetitions at the same location\n"
+         "      (default; summarize with --warn-repeated=no)")
         ("rewrite-minimize"         , flag(grOpts_.rewriteMinimize = false), "Rewrite minimize constraints into rules")
         ("keep-facts"               , flag(grOpts_.keepFacts = false), "Do not remove facts from normal rules")
+        ("explain-grounding"        , flag(grOpts_.explainGrounding = false), "Print the join plan of each rule with estimated\n"
+         "      and actual bindings to stderr after grounding")
         ;
     root.add(gringo);
     claspConfig_.addOptions(root);
@@ -768,6 +904,50 @@ ClingoLib::~ClingoLib() {
     clasp_.shutdown();
 }
 
+// {{{1 definition of ClingoLibTemplate
+
+ClingoLibTemplate::ClingoLibTemplate(Scripts &scripts, int argc, char const * const *argv) {
+    ClingoLib lib(scripts, argc, argv, nullptr, 0, this);
+    grOpts_ = lib.grOpts_;
+    record(lib.claspConfig_, Clasp::Cli::ClaspCliConfig::KEY_ROOT);
+    // check that the recorded values can be replayed
+    Clasp::Cli::ClaspCliConfig config;
+    apply(config);
+}
+
+void ClingoLibTemplate::record(Clasp::Cli::ClaspCliConfig &config, unsigned key) {
+    int nSubkeys = 0, arrLen = 0, nValues = 0;
+    char const *help = nullptr;
+    if (config.getKeyInfo(key, &nSubkeys, &arrLen, &help, &nValues) < 0) { return; }
+    std::string value;
+    if (nValues >= 0 && config.getValue(key, value) >= 0) {
+        values_.emplace_back(key, std::move(value));
+    }
+    if (arrLen > 0) {
+        arrays_.emplace_back(key, arrLen);
+        for (int i = 0; i < arrLen; ++i) {
+            unsigned elem = config.getArrKey(key, i);
+            if (elem != Clasp::Cli::ClaspCliConfig::KEY_INVALID) { record(config, elem); }
+        }
+    }
+    for (int i = 0; i < nSubkeys; ++i) {
+        unsigned sub = config.getKey(key, config.getSubkey(key, i));
+        if (sub != Clasp::Cli::ClaspCliConfig::KEY_INVALID) { record(config, sub); }
+    }
+}
+
+void ClingoLibTemplate::apply(Clasp::Cli::ClaspCliConfig &config) const {
+    // NOTE: accessing array elements makes sure that they exist
+    for (auto &arr : arrays_) {
+        for (unsigned i = 0; i < arr.second; ++i) { config.getArrKey(arr.first, i); }
+    }
+    for (auto &val : values_) {
+        if (config.setValue(val.first, val.second.c_str()) <= 0) {
+            throw std::runtime_error("could not set option value");
+        }
+    }
+}
+
 // }}}1
 
 } // namespace Gringo
@@ -35,6 +35,12 @@
 #include <gringo/input/groundtermparser.hh>
 #include <gringo/input/programbuilder.hh>
 #include <gringo/input/nongroundparser.hh>
+#include <cstdio>
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
 
 #if defined CLINGO_NO_THREAD_LOCAL && ! defined EMSCRIPTEN
 #   include <thread>
@@ -341,12 +347,21 @@ extern "C" clingo_symbol_type_t clingo_symbol_type(clingo_symbol_t val) {
 }
 
 extern "C" bool clingo_symbol_to_string_size(clingo_symbol_t val, size_t *n) {
-    GRINGO_CLINGO_TRY { *n = print_size([&val](std::ostream &out) { Symbol(val).print(out); }); }
+    GRINGO_CLINGO_TRY {
+        std::string str;
+        Symbol(val).print(str);
+        *n = str.size() + 1;
+    }
     GRINGO_CLINGO_CATCH;
 }
 
 extern "C" bool clingo_symbol_to_string(clingo_symbol_t val, char *ret, size_t n) {
-    GRINGO_CLINGO_TRY { print(ret, n, [&val](std::ostream &out) { Symbol(val).print(out); }); }
+    GRINGO_CLINGO_TRY {
+        std::string str;
+        Symbol(val).print(str);
+        if (n < str.size() + 1) { throw std::runtime_error("output buffer too small"); }
+        std::strcpy(ret, str.c_str());
+    }
     GRINGO_CLINGO_CATCH;
 }
 
@@ -615,6 +630,49 @@ extern "C" bool clingo_assignment_is_total(clingo_assignment_t *assignment) {
     return assignment->isTotal();
 }
 
+namespace {
+
+// NOTE: all assignments passed to propagators are clasp assignments
+Clasp::Solver const &trailSolver(clingo_assignment_t *ass) {
+    return static_cast<Clasp::ClingoAssignment const &>(static_cast<Potassco::AbstractAssignment const &>(*ass)).solver();
+}
+
+uint32_t trailBegin(Clasp::Solver const &s, uint32_t level) {
+    if (level > s.decisionLevel()) { throw std::runtime_error("invalid decision level"); }
+    return level > 0 ? s.levelStart(level) : 0;
+}
+
+} // namespace
+
+extern "C" bool clingo_assignment_trail_size(clingo_assignment_t *ass, uint32_t *ret) {
+    GRINGO_CLINGO_TRY { *ret = trailSolver(ass).trail().size(); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_assignment_trail_at(clingo_assignment_t *ass, uint32_t offset, clingo_literal_t *ret) {
+    GRINGO_CLINGO_TRY {
+        auto &trail = trailSolver(ass).trail();
+        if (offset >= trail.size()) { throw std::runtime_error("invalid trail offset"); }
+        *ret = Clasp::encodeLit(trail[offset]);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_assignment_trail_begin(clingo_assignment_t *ass, uint32_t level, uint32_t *ret) {
+    GRINGO_CLINGO_TRY { *ret = trailBegin(trailSolver(ass), level); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_assignment_trail_end(clingo_assignment_t *ass, uint32_t level, uint32_t *ret) {
+    GRINGO_CLINGO_TRY {
+        auto &s = trailSolver(ass);
+        // Note: checked first because level + 1 overflows for the largest level
+        if (level > s.decisionLevel()) { throw std::runtime_error("invalid decision level"); }
+        *ret = level == s.decisionLevel() ? s.trail().size() : trailBegin(s, level + 1);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 // {{{1 propagate init
 
 extern "C" bool clingo_propagate_init_solver_literal(clingo_propagate_init_t *init, clingo_literal_t lit, clingo_literal_t *ret) {
@@ -632,6 +690,21 @@ extern "C" bool clingo_propagate_init_add_watch_to_thread(clingo_propagate_init_
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_propagate_init_solver_literals(clingo_propagate_init_t *init, clingo_literal_t const *lits, size_t size, clingo_literal_t *ret) {
+    GRINGO_CLINGO_TRY { init->mapLits(lits, size, ret); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_propagate_init_add_watches(clingo_propagate_init_t *init, clingo_literal_t const *lits, size_t size) {
+    GRINGO_CLINGO_TRY { init->addWatches(lits, size); }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_propagate_init_add_watches_to_thread(clingo_propagate_init_t *init, clingo_literal_t const *lits, size_t size, uint32_t thread_id) {
+    GRINGO_CLINGO_TRY { init->addWatches(thread_id, lits, size); }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" int clingo_propagate_init_number_of_threads(clingo_propagate_init_t *init) {
     return init->threads();
 }
@@ -675,6 +748,20 @@ extern "C" bool clingo_propagate_control_add_clause(clingo_propagate_control_t *
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_propagate_control_add_clauses(clingo_propagate_control_t *ctl, size_t size, size_t const *offsets, clingo_literal_t const *literals, clingo_clause_type_t const *types, bool *ret) {
+    GRINGO_CLINGO_TRY {
+        for (size_t i = 0; i < size; ++i) {
+            if (offsets[i] > offsets[i + 1]) { throw std::invalid_argument("offsets must be non-decreasing"); }
+        }
+        *ret = true;
+        for (size_t i = 0; i < size && *ret; ++i) {
+            Potassco::LitSpan clause{literals + offsets[i], offsets[i + 1] - offsets[i]};
+            *ret = ctl->addClause(clause, Potassco::Clause_t(types ? types[i] : clingo_clause_type_learnt));
+        }
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_propagate_control_propagate(clingo_propagate_control_t *ctl, bool *ret) {
     GRINGO_CLINGO_TRY { *ret = ctl->propagate(); }
     GRINGO_CLINGO_CATCH;
@@ -974,6 +1061,23 @@ extern "C" bool clingo_parse_term(char const *str, clingo_logger_t logger, void
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_parse_terms(char const * const *str, size_t size, clingo_logger_t logger, void *data, unsigned message_limit, clingo_symbol_t *ret) {
+    GRINGO_CLINGO_TRY {
+        Input::GroundTermParser parser;
+        Logger::Printer printer;
+        if (logger) {
+            printer = [logger, data](Warnings code, char const *msg) { logger(static_cast<clingo_warning_t>(code), msg, data); };
+        }
+        Logger log(printer, message_limit);
+        for (auto it = str, ie = str + size; it != ie; ++it, ++ret) {
+            Symbol sym = parser.parse(*it, log);
+            if (sym.type() == SymbolType::Special) { throw std::runtime_error("parsing failed"); }
+            *ret = sym.rep();
+        }
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_parse_program(char const *program, clingo_ast_callback_t cb, void *cb_data, clingo_logger_t logger, void *logger_data, unsigned message_limit) {
     GRINGO_CLINGO_TRY {
         Input::ASTBuilder builder([cb, cb_data](clingo_ast_statement_t const &stm) { handleCError(cb(&stm, cb_data)); });
@@ -1021,6 +1125,23 @@ extern "C" bool clingo_backend_rule(clingo_backend_t *backend, bool choice, clin
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_backend_rules(clingo_backend_t *backend, bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, size_t const *body_offsets, clingo_literal_t const *bodies) {
+    GRINGO_CLINGO_TRY {
+        for (size_t i = 0; i < size; ++i) {
+            if (head_offsets[i] > head_offsets[i + 1] || body_offsets[i] > body_offsets[i + 1]) {
+                throw std::invalid_argument("offsets must be non-decreasing");
+            }
+        }
+        auto &out = *backend->getBackend();
+        for (size_t i = 0; i < size; ++i) {
+            Potassco::AtomSpan head{heads + head_offsets[i], head_offsets[i + 1] - head_offsets[i]};
+            Potassco::LitSpan body{bodies + body_offsets[i], body_offsets[i + 1] - body_offsets[i]};
+            outputRule(out, choices && choices[i], head, body);
+        }
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_backend_weight_rule(clingo_backend_t *backend, bool choice, clingo_atom_t const *head, size_t head_n, clingo_weight_t lower, clingo_weighted_literal_t const *body, size_t body_n) {
     GRINGO_CLINGO_TRY { outputRule(*backend->getBackend(), choice, {head, head_n}, lower, {reinterpret_cast<Potassco::WeightLit_t const *>(body), body_n}); }
     GRINGO_CLINGO_CATCH;
@@ -1074,6 +1195,17 @@ extern "C" void clingo_solve_handle_wait(clingo_solve_handle_t *handle, double t
     try { *result = handle->wait(timeout); }
     catch (...) { std::terminate(); }
 }
+extern "C" bool clingo_solve_handle_try_get(clingo_solve_handle_t *handle, clingo_solve_result_bitset_t *result, bool *ready) {
+    GRINGO_CLINGO_TRY {
+        SolveResult ret{SolveResult::Unknown, false, false};
+        if ((*ready = handle->tryGet(ret))) { *result = ret; }
+    }
+    GRINGO_CLINGO_CATCH;
+}
+extern "C" bool clingo_solve_handle_notifier(clingo_solve_handle_t *handle, int *fd) {
+    GRINGO_CLINGO_TRY { *fd = handle->notifier(); }
+    GRINGO_CLINGO_CATCH;
+}
 extern "C" bool clingo_solve_handle_cancel(clingo_solve_handle_t *handle) {
     GRINGO_CLINGO_TRY { handle->cancel(); }
     GRINGO_CLINGO_CATCH;
@@ -1348,9 +1480,47 @@ extern "C" bool clingo_control_clasp_facade(clingo_control_t *ctl, void **clasp)
 
 namespace {
 
+template <class Lit>
+struct RuleBatch {
+    RuleBatch(size_t capacity) : choices(capacity > 0 ? new bool[capacity] : nullptr), headOffsets{0}, bodyOffsets{0} { }
+    void add(bool choice, Potassco::AtomSpan const &head, Potassco::Span<Lit> const &body) {
+        choices[size++] = choice;
+        heads.insert(heads.end(), begin(head), end(head));
+        headOffsets.emplace_back(heads.size());
+        bodies.insert(bodies.end(), begin(body), end(body));
+        bodyOffsets.emplace_back(bodies.size());
+    }
+    void clear() {
+        size = 0;
+        headOffsets.resize(1);
+        heads.clear();
+        bounds.clear();
+        bodyOffsets.resize(1);
+        bodies.clear();
+    }
+
+    size_t size = 0;
+    std::unique_ptr<bool[]> choices;
+    std::vector<size_t> headOffsets;
+    std::vector<Potassco::Atom_t> heads;
+    std::vector<Potassco::Weight_t> bounds;
+    std::vector<size_t> bodyOffsets;
+    std::vector<Lit> bodies;
+};
+
 class Observer : public Backend {
 public:
-    Observer(clingo_ground_program_observer_t obs, void *data) : obs_(obs), data_(data) { }
+    Observer(clingo_ground_program_observer_t obs, void *data)
+    : Observer(obs, {nullptr, nullptr, nullptr, nullptr}, 0, data) { }
+    Observer(clingo_ground_program_observer_t obs, clingo_ground_program_batch_observer_t batch, size_t batchSize, void *data)
+    : obs_(obs)
+    , batch_(batch)
+    , batchSize_(batchSize)
+    , rules_(batch.rules ? batchSize : 0)
+    , weightRules_(batch.weight_rules ? batchSize : 0)
+    , elemOffsets_{0}
+    , condOffsets_{0}
+    , data_(data) { }
     ~Observer() override = default;
 
     void initProgram(bool incremental) override {
@@ -1360,14 +1530,24 @@ public:
         call(obs_.begin_step);
     }
     void endStep() override {
+        flush();
         call(obs_.end_step);
     }
 
     void rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, const Potassco::LitSpan& body) override {
-        call(obs_.rule, ht == Potassco::Head_t::Choice, head.first, head.size, body.first, body.size);
+        if (batch_.rules) {
+            rules_.add(ht == Potassco::Head_t::Choice, head, body);
+            if (rules_.size == batchSize_) { flushRules(); }
+        }
+        else { call(obs_.rule, ht == Potassco::Head_t::Choice, head.first, head.size, body.first, body.size); }
     }
     void rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, Weight_t bound, const Potassco::WeightLitSpan& body) override {
-        call(obs_.weight_rule, ht == Potassco::Head_t::Choice, head.first, head.size, bound, reinterpret_cast<clingo_weighted_literal_t const *>(body.first), body.size);
+        if (batch_.weight_rules) {
+            weightRules_.add(ht == Potassco::Head_t::Choice, head, body);
+            weightRules_.bounds.emplace_back(bound);
+            if (weightRules_.size == batchSize_) { flushWeightRules(); }
+        }
+        else { call(obs_.weight_rule, ht == Potassco::Head_t::Choice, head.first, head.size, bound, reinterpret_cast<clingo_weighted_literal_t const *>(body.first), body.size); }
     }
     void minimize(Weight_t prio, const Potassco::WeightLitSpan& lits) override {
         call(obs_.minimize, prio, reinterpret_cast<clingo_weighted_literal_t const *>(lits.first), lits.size);
@@ -1376,7 +1556,12 @@ public:
         call(obs_.project, atoms.first, atoms.size);
     }
     void output(Symbol sym, Potassco::Atom_t atom) override {
-        call(obs_.output_atom, sym.rep(), atom);
+        if (batch_.output_atoms) {
+            symbols_.emplace_back(sym.rep());
+            atoms_.emplace_back(atom);
+            if (atoms_.size() == batchSize_) { flushOutputAtoms(); }
+        }
+        else { call(obs_.output_atom, sym.rep(), atom); }
     }
     void output(Symbol sym, Potassco::LitSpan const& condition) override {
         call(obs_.output_term, sym.rep(), condition.first, condition.size);
@@ -1408,7 +1593,15 @@ public:
         call(obs_.theory_term_compound, termId, cId, args.first, args.size);
     }
     void theoryElement(Id_t elementId, const Potassco::IdSpan& terms, const Potassco::LitSpan& cond) override {
-        call(obs_.theory_element, elementId, terms.first, terms.size, cond.first, cond.size);
+        if (batch_.theory_elements) {
+            elemIds_.emplace_back(elementId);
+            elemTerms_.insert(elemTerms_.end(), begin(terms), end(terms));
+            elemOffsets_.emplace_back(elemTerms_.size());
+            conds_.insert(conds_.end(), begin(cond), end(cond));
+            condOffsets_.emplace_back(conds_.size());
+            if (elemIds_.size() == batchSize_) { flushTheoryElements(); }
+        }
+        else { call(obs_.theory_element, elementId, terms.first, terms.size, cond.first, cond.size); }
     }
     void theoryAtom(Id_t atomOrZero, Id_t termId, const Potassco::IdSpan& elements) override {
         call(obs_.theory_atom, atomOrZero, termId, elements.first, elements.size);
@@ -1419,10 +1612,69 @@ public:
 private:
     template <class CB, class... Args>
     void call(CB *cb, Args&&... args) {
-        if (cb && !(*cb)(std::forward<Args>(args)..., data_)) { throw ClingoError(); }
+        if (cb) {
+            flush();
+            invoke(cb, std::forward<Args>(args)...);
+        }
+    }
+    template <class CB, class... Args>
+    void invoke(CB *cb, Args&&... args) {
+        if (!(*cb)(std::forward<Args>(args)..., data_)) { throw ClingoError(); }
+    }
+    // NOTE: pending batches are passed on before any other statement to
+    //       preserve the order of statements as far as possible
+    void flush() {
+        if (batchSize_ > 0) {
+            flushRules();
+            flushWeightRules();
+            flushOutputAtoms();
+            flushTheoryElements();
+        }
+    }
+    void flushRules() {
+        if (rules_.size > 0) {
+            auto &b = rules_;
+            invoke(batch_.rules, b.choices.get(), b.size, b.headOffsets.data(), b.heads.data(), b.bodyOffsets.data(), b.bodies.data());
+            b.clear();
+        }
+    }
+    void flushWeightRules() {
+        if (weightRules_.size > 0) {
+            auto &b = weightRules_;
+            invoke(batch_.weight_rules, b.choices.get(), b.size, b.headOffsets.data(), b.heads.data(), b.bounds.data(), b.bodyOffsets.data(), reinterpret_cast<clingo_weighted_literal_t const *>(b.bodies.data()));
+            b.clear();
+        }
+    }
+    void flushOutputAtoms() {
+        if (!atoms_.empty()) {
+            invoke(batch_.output_atoms, symbols_.data(), atoms_.data(), atoms_.size());
+            symbols_.clear();
+            atoms_.clear();
+        }
+    }
+    void flushTheoryElements() {
+        if (!elemIds_.empty()) {
+            invoke(batch_.theory_elements, elemIds_.data(), elemIds_.size(), elemOffsets_.data(), elemTerms_.data(), condOffsets_.data(), conds_.data());
+            elemIds_.clear();
+            elemOffsets_.resize(1);
+            elemTerms_.clear();
+            condOffsets_.resize(1);
+            conds_.clear();
+        }
     }
 private:
     clingo_ground_program_observer_t obs_;
+    clingo_ground_program_batch_observer_t batch_;
+    size_t batchSize_;
+    RuleBatch<Potassco::Lit_t> rules_;
+    RuleBatch<Potassco::WeightLit_t> weightRules_;
+    std::vector<clingo_symbol_t> symbols_;
+    std::vector<clingo_atom_t> atoms_;
+    std::vector<clingo_id_t> elemIds_;
+    std::vector<size_t> elemOffsets_;
+    std::vector<clingo_id_t> elemTerms_;
+    std::vector<size_t> condOffsets_;
+    std::vector<clingo_literal_t> conds_;
     void *data_;
 };
 
@@ -1433,11 +1685,55 @@ extern "C" bool clingo_control_register_observer(clingo_control_t *control, clin
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_control_register_batch_observer(clingo_control_t *control, clingo_ground_program_observer_t const *observer, clingo_ground_program_batch_observer_t const *batch_observer, size_t batch_size, bool replace, void *data) {
+    GRINGO_CLINGO_TRY {
+        if (batch_size == 0) { throw std::logic_error("batch size must be positive"); }
+        control->registerObserver(gringo_make_unique<Observer>(*observer, *batch_observer, batch_size, data), replace);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+namespace {
+
+std::mutex &g_parseMutex() {
+    static std::mutex mut;
+    return mut;
+}
+
+Logger::Printer makePrinter(clingo_logger_t logger, void *data) {
+    return logger ? [logger, data](Warnings code, char const *msg) { logger(static_cast<clingo_warning_t>(code), msg, data); } : Logger::Printer(nullptr);
+}
+
+} // namespace
+
 extern "C" bool clingo_control_new(char const *const * args, size_t n, clingo_logger_t logger, void *data, unsigned message_limit, clingo_control_t **ctl) {
     GRINGO_CLINGO_TRY {
-        static std::mutex mut;
-        std::lock_guard<std::mutex> grd(mut);
-        *ctl = new ClingoLib(g_scripts(), numeric_cast<int>(n), args, logger ? [logger, data](Warnings code, char const *msg) { logger(static_cast<clingo_warning_t>(code), msg, data); } : Logger::Printer(nullptr), message_limit);
+        std::lock_guard<std::mutex> grd(g_parseMutex());
+        *ctl = new ClingoLib(g_scripts(), numeric_cast<int>(n), args, makePrinter(logger, data), message_limit);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+struct clingo_control_template : ClingoLibTemplate {
+    using ClingoLibTemplate::ClingoLibTemplate;
+};
+
+extern "C" bool clingo_control_template_new(char const *const * args, size_t n, clingo_control_template_t **tpl) {
+    GRINGO_CLINGO_TRY {
+        std::lock_guard<std::mutex> grd(g_parseMutex());
+        *tpl = new clingo_control_template(g_scripts(), numeric_cast<int>(n), args);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" void clingo_control_template_free(clingo_control_template_t *tpl) {
+    delete tpl;
+}
+
+extern "C" bool clingo_control_new_from_template(clingo_control_template_t const *tpl, clingo_logger_t logger, void *data, unsigned message_limit, clingo_control_t **ctl) {
+    GRINGO_CLINGO_TRY {
+        // NOTE: no options are parsed here so there is no need to lock
+        *ctl = new ClingoLib(g_scripts(), *tpl, makePrinter(logger, data), message_limit);
     }
     GRINGO_CLINGO_CATCH;
 }
@@ -1506,6 +1802,10 @@ extern "C" CLINGO_VISIBILITY_DEFAULT char const *clingo_script_version_(clingo_a
 }
 
 extern "C" CLINGO_VISIBILITY_DEFAULT int clingo_main_(int argc, char *argv[]) {
+    // NOTE: models are flushed one at a time; if the output is redirected, a
+    //       large buffer makes sure that each model is written with a single
+    //       system call instead of one per few kilobytes
+    if (!isatty(fileno(stdout))) { std::setvbuf(stdout, nullptr, _IOFBF, 1 << 20); }
     Gringo::ClingoApp app;
     return app.main(argc, argv);
 }
@@ -57,8 +57,10 @@ struct GringoOptions {
     bool                          wNoVariableUnbounded  = false;
     bool                          wNoGlobalVariable     = false;
     bool                          wNoOther              = false;
+    bool                          warnRepeated          = false;
     bool                          rewriteMinimize       = false;
     bool                          keepFacts             = false;
+    bool                          explainGrounding      = false;
     Foobar                        foobar;
 };
 
@@ -104,6 +106,7 @@ struct IncrementalControl : Control {
         logger_.enable(Warnings::FileIncluded, !opts.wNoFileIncluded);
         logger_.enable(Warnings::GlobalVariable, !opts.wNoGlobalVariable);
         logger_.enable(Warnings::Other, !opts.wNoOther);
+        logger_.aggregate(!opts.warnRepeated);
         for (auto &x : opts.defines) {
             LOG << "define: " << x << std::endl;
             parser.parseDefine(x, logger_);
@@ -161,11 +164,17 @@ struct IncrementalControl : Control {
             Ground::Program gPrg(prg.toGround(sigs, out.data, logger_));
             LOG << "************* intermediate program *************" << std::endl << gPrg << std::endl;
             LOG << "*************** grounded program ***************" << std::endl;
-            gPrg.ground(params, scripts, out, logger_);
+            gPrg.ground(params, scripts, out, logger_, opts.explainGrounding ? &std::cerr : nullptr);
+            logger_.summarize();
             if (opts.verbose) {
                 std::cerr << "body=0\tbody=1\tbody=2\tbody>2\tintermediate-rule" << std::endl;
                 prg.printWithStats(std::cerr);
             }
+            else if (opts.outputFormat == Output::OutputFormat::COUNT) {
+                // the totals of the step follow once the step ends
+                std::cout << "body=0\tbody=1\tbody=2\tbody>2\tintermediate-rule" << "\n";
+                prg.printWithStats(std::cout);
+            }
         }
     }
     void add(std::string const &name, StringVec const &params, std::string const &part) override {
@@ -312,12 +321,16 @@ struct GringoApp : public Potassco::Application {
               ("intermediate", Output::OutputFormat::INTERMEDIATE)
               ("text", Output::OutputFormat::TEXT)
               ("reify", Output::OutputFormat::REIFY)
-              ("smodels", Output::OutputFormat::SMODELS)), "Choose output format:\n"
+              ("smodels", Output::OutputFormat::SMODELS)
+              ("count", Output::OutputFormat::COUNT)), "Choose output format:\n"
              "      intermediate: print intermediate format\n"
              "      text        : print plain text format\n"
              "      reify       : print program as reified facts\n"
              "      smodels     : print smodels format\n"
-             "                    (only supports basic features)")
+             "                    (only supports basic features)\n"
+             "      count       : only print the number of ground rules\n"
+             "                    per statement and statistics about\n"
+             "                    the size of the ground program")
             ("output-debug,@1", storeTo(grOpts_.outputOptions.debug = Output::OutputDebug::NONE, values<Output::OutputDebug>()
               ("none", Output::OutputDebug::NONE)
               ("text", Output::OutputDebug::TEXT)
@@ -336,8 +349,12 @@ struct GringoApp : public Potassco::Application {
              "      [no-]variable-unbounded:  $x > 10.\n"
              "      [no-]global-variable:     :- #count { X } = 1, X = 1.\n"
              "      [no-]other:               uncategorized warnings")
+            ("warn-repeated,@2", flag(grOpts_.warnRepeated = false), "Report every occurrence of a warning instead of\n"
+             "      summarizing repetitions at the same location")
             ("rewrite-minimize,@1", flag(grOpts_.rewriteMinimize = false), "Rewrite minimize constraints into rules")
             ("keep-facts,@1", flag(grOpts_.keepFacts = false), "Do not remove facts from normal rules")
+            ("explain-grounding,@2", flag(grOpts_.explainGrounding = false), "Print the join plan of each rule with estimated\n"
+             "      and actual bindings to stderr after grounding")
             ("reify-sccs,@1", flag(grOpts_.outputOptions.reifySCCs = false), "Calculate SCCs for reified output")
             ("reify-steps,@1", flag(grOpts_.outputOptions.reifySteps = false), "Add step numbers to reified output")
             ("foobar,@4", storeTo(grOpts_.foobar, parseFoobar), "Foobar")
@@ -53,7 +53,7 @@ SymVec Scripts::call(Location const &loc, String name, SymSpan args, Logger &log
             return script.second->call(loc, name, args, log);
         }
     }
-    GRINGO_REPORT(log, Warnings::OperationUndefined)
+    GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc)
         << loc << ": info: operation undefined:\n"
         << "  function '" << name << "' not found\n"
         ;
@@ -25,6 +25,10 @@
 #include "tests.hh"
 #include <iostream>
 #include <fstream>
+#include <map>
+#if !defined(_WIN32)
+#include <poll.h>
+#endif
 #ifdef _MSC_VER
 #pragma warning (disable : 4996) // 'tmpnam': may be unsafe.
 #endif
@@ -41,6 +45,34 @@ TEST_CASE("parse_term", "[clingo]") {
     REQUIRE(messages.size() == 0);
 }
 
+TEST_CASE("parse_terms", "[clingo]") {
+    std::vector<char const *> strs{"1", "p(a,\"s\")", "(1,2)", "p(1+2)", "-q"};
+    REQUIRE(parse_terms(strs) == (SymbolVector{Number(1), Function("p", {Id("a"), String("s")}), Function("", {Number(1), Number(2)}), Function("p", {Number(3)}), Id("q", false)}));
+    REQUIRE(parse_terms({}).empty());
+    strs.emplace_back("p(");
+    REQUIRE_THROWS(parse_terms(strs));
+}
+
+void flatten_configuration(Configuration conf, std::string const &path, std::map<std::string, std::string> &out) {
+    if (conf.is_value() && conf.is_assigned()) { out.emplace(path, conf.value()); }
+    if (conf.is_array()) {
+        for (size_t i = 0; i < conf.size(); ++i) {
+            flatten_configuration(conf[i], path + "[" + std::to_string(i) + "]", out);
+        }
+    }
+    if (conf.is_map()) {
+        for (auto key : conf.keys()) {
+            flatten_configuration(conf[key], path.empty() ? key : path + "." + key, out);
+        }
+    }
+}
+
+std::map<std::string, std::string> flatten_configuration(Configuration conf) {
+    std::map<std::string, std::string> out;
+    flatten_configuration(conf, "", out);
+    return out;
+}
+
 class Observer : public GroundProgramObserver {
 public:
     Observer(std::vector<std::string> &trail)
@@ -57,6 +89,9 @@ public:
     }
 
     void rule(bool choice, AtomSpan head, LiteralSpan body) override {
+        trail_.emplace_back(rule_to_string(choice, head, body));
+    }
+    static std::string rule_to_string(bool choice, AtomSpan head, LiteralSpan body) {
         std::ostringstream out;
         out << "R: ";
         if (choice) { out << "{"; }
@@ -75,12 +110,17 @@ public:
             if (b > 0) { out << b; }
             else       { out << "~" << -b; }
         }
-        trail_.emplace_back(out.str());
+        return out.str();
     }
 private:
     std::vector<std::string> &trail_;
 };
 
+struct BatchObserverData {
+    std::vector<std::string> trail;
+    std::vector<size_t> sizes;
+};
+
 TEST_CASE("solving", "[clingo]") {
     SECTION("with control") {
         MessageVec messages;
@@ -118,8 +158,10 @@ TEST_CASE("solving", "[clingo]") {
             auto stats = ctl.statistics();
             std::copy(stats.keys().begin(), stats.keys().end(), std::back_inserter(keys_root));
             std::sort(keys_root.begin(), keys_root.end());
-            std::vector<std::string> keys_check = { "accu", "problem", "solving", "summary" };
+            std::vector<std::string> keys_check = { "accu", "grounder", "problem", "solving", "summary" };
             REQUIRE(keys_root == keys_check);
+            REQUIRE(stats["grounder.lookups"].type() == StatisticsType::Value);
+            REQUIRE(stats["grounder.filtered"] <= stats["grounder.lookups"]);
             auto solving = stats["solving"];
             REQUIRE(solving["solver"].type() == StatisticsType::Array);
             REQUIRE(solving["solvers"].type() == StatisticsType::Map);
@@ -215,6 +257,26 @@ TEST_CASE("solving", "[clingo]") {
             // Note: I don't have a good idea how to test this one
             // void heuristic(atom_t atom, HeuristicType type, int bias, unsigned priority, LitSpan condition);
         }
+        SECTION("backend-rules") {
+            {
+                auto backend = ctl.backend();
+                atom_t a = backend.add_atom(), b = backend.add_atom(), c = backend.add_atom();
+                // {a}. b :- not a. :- c. c :- a, b.
+                std::vector<size_t> head_offsets{0, 1, 2, 2, 3};
+                std::vector<atom_t> heads{a, b, c};
+                std::vector<size_t> body_offsets{0, 0, 1, 2, 4};
+                std::vector<literal_t> bodies{-literal_t(a), literal_t(c), literal_t(a), literal_t(b)};
+                bool choices[] = {true, false, false, false};
+                backend.rules(Span<bool>(choices, 4), head_offsets, heads, body_offsets, bodies);
+                REQUIRE_THROWS(backend.rules({}, head_offsets, heads, {0, 0}, bodies));
+                REQUIRE_THROWS_AS(backend.rules({}, {0, 4}, heads, {0, 0}, bodies), std::invalid_argument);
+                size_t decreasing[] = {1, 0}, empty[] = {0, 0};
+                REQUIRE_FALSE(clingo_backend_rules(backend.to_c(), nullptr, 1, decreasing, heads.data(), empty, bodies.data()));
+                REQUIRE(clingo_error_code() == clingo_error_logic);
+            }
+            test_solve(ctl.solve(), models);
+            REQUIRE(models == (ModelVec{{},{}}));
+        }
         SECTION("backend-project") {
             ctl.configuration()["solve.project"] = "auto";
             {
@@ -314,6 +376,27 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(models == ModelVec({{},{Id("a")}}));
             REQUIRE(messages.empty());
         }
+#endif
+#if defined(CLASP_HAS_THREADS) && CLASP_HAS_THREADS == 1 && !defined(_WIN32)
+        SECTION("notifier") {
+            ctl.add("base", {}, "{a}.");
+            ctl.ground({{"base", {}}});
+            auto handle = ctl.solve(LiteralSpan{}, nullptr, true, true);
+            pollfd fd{handle.notifier(), POLLIN, 0};
+            SolveResult ret;
+            int n = 0;
+            while (true) {
+                REQUIRE(poll(&fd, 1, -1) == 1);
+                if (!handle.try_get(ret)) { continue; }
+                if (!handle.model()) { break; }
+                ++n;
+                handle.resume();
+            }
+            REQUIRE(n == 2);
+            REQUIRE(ret.is_satisfiable());
+            REQUIRE(ret.is_exhausted());
+            REQUIRE(messages.empty());
+        }
 #endif
         SECTION("model") {
             ctl.add("base", {}, "a. $x $= 1. #show b.");
@@ -603,6 +686,42 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(models == ModelVec({}));
             REQUIRE(trail == std::vector<std::string>({"IP: incremental", "BS", "R: 1:-~1", "ES"}));
         }
+        SECTION("ground program batch observer") {
+            std::vector<std::string> trail;
+            Observer obs(trail);
+            ctl.register_observer(obs);
+            BatchObserverData data;
+            clingo_ground_program_observer_t observer = {};
+            observer.end_step = [](void *d) {
+                static_cast<BatchObserverData*>(d)->trail.emplace_back("ES");
+                return true;
+            };
+            clingo_ground_program_batch_observer_t batch = {};
+            batch.rules = [](bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, size_t const *body_offsets, clingo_literal_t const *bodies, void *d) {
+                auto &data = *static_cast<BatchObserverData*>(d);
+                data.sizes.emplace_back(size);
+                for (size_t i = 0; i < size; ++i) {
+                    data.trail.emplace_back(Observer::rule_to_string(choices[i],
+                        {heads + head_offsets[i], head_offsets[i + 1] - head_offsets[i]},
+                        {bodies + body_offsets[i], body_offsets[i + 1] - body_offsets[i]}));
+                }
+                return true;
+            };
+            REQUIRE_FALSE(clingo_control_register_batch_observer(ctl.to_c(), &observer, &batch, 0, false, &data));
+            REQUIRE(clingo_control_register_batch_observer(ctl.to_c(), &observer, &batch, 2, false, &data));
+            ctl.add("base", {}, "{a; b}. c :- a. d :- b. e :- c, d.");
+            ctl.ground({{"base", {}}});
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(trail.size() > 5);
+            REQUIRE(data.trail == std::vector<std::string>(trail.begin() + 2, trail.end()));
+            size_t n = 0;
+            for (auto size : data.sizes) {
+                REQUIRE(size > 0);
+                REQUIRE(size <= 2);
+                n += size;
+            }
+            REQUIRE(n == trail.size() - 3);
+        }
         SECTION("events") {
             ctl.add("base", {}, "{a}.");
             ctl.ground({{"base", {}}});
@@ -632,6 +751,30 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(f == 1);
         }
     }
+    SECTION("with template") {
+        ControlTemplate tpl{{"0", "-c", "n=3"}};
+        for (int i = 0; i < 2; ++i) {
+            ModelVec models;
+            auto ctl = tpl.create_control();
+            REQUIRE(ctl.configuration()["solve"]["models"].value() == "0");
+            REQUIRE(ctl.get_const("n") == Number(3));
+            ctl.add("base", {}, "{a}.");
+            ctl.ground({{"base", {}}});
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models == ModelVec({{},{Id("a")}}));
+        }
+        REQUIRE_THROWS(ControlTemplate{{"--no-such-option"}});
+    }
+    SECTION("with template configuration") {
+        std::vector<char const *> args{"--heuristic=Vsids", "-t", "2", "--opt-strategy=usc"};
+        ControlTemplate tpl{args};
+        Control ctl{args};
+        auto from_tpl = tpl.create_control();
+        auto expected = flatten_configuration(ctl.configuration());
+        REQUIRE(flatten_configuration(from_tpl.configuration()) == expected);
+        REQUIRE(flatten_configuration(Control().configuration()) != expected);
+        REQUIRE(expected["solve.parallel_mode"].compare(0, 1, "2") == 0);
+    }
 }
 
 } } // namespace Test Clingo
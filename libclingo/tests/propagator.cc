@@ -407,6 +407,22 @@ public:
         REQUIRE(!ass.has_literal(1000));
         auto decision = ass.decision(ass.decision_level());
         REQUIRE(ass.level(decision) == ass.decision_level());
+        auto level = ass.decision_level();
+        REQUIRE(ass.trail_begin(0) == 0);
+        REQUIRE(ass.trail_end(level) == ass.trail_size());
+        REQUIRE_THROWS_AS(ass.trail_end(level + 1), std::runtime_error);
+        REQUIRE_THROWS_AS(ass.trail_end(std::numeric_limits<uint32_t>::max()), std::runtime_error);
+        REQUIRE(ass.trail_at(ass.trail_begin(level)) == decision);
+        for (uint32_t i = 0, e = ass.trail_size(); i != e; ++i) {
+            REQUIRE(ass.is_true(ass.trail_at(i)));
+        }
+        for (auto lit : changes) {
+            bool found = false;
+            for (uint32_t i = ass.trail_begin(level), e = ass.trail_end(level); i != e; ++i) {
+                found = found || ass.trail_at(i) == lit;
+            }
+            REQUIRE(found);
+        }
         if (count_ == 1) {
             int a = changes[0];
             REQUIRE(changes.size() == 1);
@@ -443,7 +459,22 @@ public:
     }
     void propagate(PropagateControl &ctl, LiteralSpan changes) override {
         count_+= changes.size();
-        REQUIRE_FALSE((enable && count_ == 2 && ctl.add_clause({-a_, -b_}, type) && ctl.propagate()));
+        if (batch) {
+            // the first clause is conflicting and the second one, which would
+            // remove the empty model, must not be added anymore
+            std::vector<size_t> offsets{0, 2, 4};
+            std::vector<literal_t> literals{-a_, -b_, a_, b_};
+            std::vector<ClauseType> types{type, type};
+            size_t decreasing[] = {2, 0};
+            bool result;
+            REQUIRE_FALSE(clingo_propagate_control_add_clauses(ctl.to_c(), 1, decreasing, literals.data(), nullptr, &result));
+            REQUIRE(clingo_error_code() == clingo_error_logic);
+            REQUIRE_THROWS_AS(ctl.add_clauses({0, 5}, literals), std::invalid_argument);
+            REQUIRE_FALSE((enable && count_ == 2 && ctl.add_clauses(offsets, literals, types) && ctl.propagate()));
+        }
+        else {
+            REQUIRE_FALSE((enable && count_ == 2 && ctl.add_clause({-a_, -b_}, type) && ctl.propagate()));
+        }
     }
     void undo(PropagateControl const &, LiteralSpan undo) override {
         count_-= undo.size();
@@ -451,6 +482,7 @@ public:
 public:
     ClauseType type = ClauseType::Learnt;
     bool enable = true;
+    bool batch = false;
 private:
     literal_t a_;
     literal_t b_;
@@ -465,12 +497,22 @@ public:
         b = init.solver_literal(init.symbolic_atoms().find(Id("b"))->literal());
         auto c = init.solver_literal(init.symbolic_atoms().find(Id("c"))->literal());
         auto d = init.solver_literal(init.symbolic_atoms().find(Id("d"))->literal());
-        init.add_watch(a, 0);
-        init.add_watch(-a, 0);
-        init.add_watch(b, 0);
-        init.add_watch(-b, 0);
-        init.add_watch(-b, 1);
-        init.add_watch(b, 1);
+        if (batch) {
+            auto lits = init.solver_literals({
+                init.symbolic_atoms().find(Id("a"))->literal(),
+                init.symbolic_atoms().find(Id("b"))->literal()});
+            REQUIRE(lits == std::vector<literal_t>({a, b}));
+            init.add_watches({a, -a, b, -b}, 0);
+            init.add_watches({-b, b}, 1);
+        }
+        else {
+            init.add_watch(a, 0);
+            init.add_watch(-a, 0);
+            init.add_watch(b, 0);
+            init.add_watch(-b, 0);
+            init.add_watch(-b, 1);
+            init.add_watch(b, 1);
+        }
         auto assignment = init.assignment();
         REQUIRE(assignment.truth_value(a) == Clingo::TruthValue::Free);
         REQUIRE(assignment.truth_value(b) == Clingo::TruthValue::Free);
@@ -497,6 +539,7 @@ public:
     std::set<literal_t> propagated;
     literal_t a;
     literal_t b;
+    bool batch = false;
 private:
     std::mutex mut_;
     std::condition_variable cv;
@@ -573,6 +616,8 @@ TEST_CASE("propagator", "[clingo][propagator]") {
     }
     SECTION("add_watch") {
         TestAddWatch prop;
+        SECTION("single") { }
+        SECTION("batch") { prop.batch = true; }
         ctl.configuration()["solve"]["parallel_mode"] = "2";
         ctl.register_propagator(prop, false);
         ctl.add("base", {}, "{a;b;c;d}. c. :- d.");
@@ -639,6 +684,17 @@ TEST_CASE("propagator", "[clingo][propagator]") {
             test_solve(ctl.solve(), models);
             REQUIRE(models.size() == 3);
         }
+        SECTION("batch") {
+            p.type = ClauseType::Static;
+            p.batch = true;
+            ctl.add("base", {}, "{a; b}.");
+            ctl.ground({{"base", {}}}, nullptr);
+            test_solve(ctl.solve(), models);
+            REQUIRE(models.size() == 3);
+            p.enable = false;
+            test_solve(ctl.solve(), models);
+            REQUIRE(models.size() == 3);
+        }
         SECTION("volatile") {
             p.type = ClauseType::Volatile;
             ctl.add("base", {}, "{a; b}.");
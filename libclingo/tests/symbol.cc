@@ -81,6 +81,9 @@ TEST_CASE("symbol", "[clingo]") {
         REQUIRE(!sym.is_negative());
         REQUIRE(S("f") == sym.name());
         REQUIRE("f(42,#inf,#sup,\"x\",-x)" == sym.to_string());
+        char buf[8];
+        REQUIRE_FALSE(clingo_symbol_to_string(sym.to_c(), buf, sizeof(buf)));
+        REQUIRE(clingo_error_code() == clingo_error_runtime);
         REQUIRE((args.size() == sym.arguments().size() && std::equal(args.begin(), args.end(), sym.arguments().begin())));
         try { sym.number(); }
         catch (std::exception const &e) { REQUIRE(e.what() == S("unexpected")); }
@@ -0,0 +1,51 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#ifndef _GRINGO_DECOMPRESS_HH
+#define _GRINGO_DECOMPRESS_HH
+
+#include <istream>
+#include <memory>
+
+namespace Gringo {
+
+// Checks whether the given stream starts with the magic number of a gzip
+// file. No characters are consumed.
+bool isCompressed(std::istream &in);
+
+// Returns a stream providing the decompressed content of the given
+// gzip-compressed stream. Concatenated gzip members are supported.
+//
+// If threaded is true, decompression runs on a separate thread overlapping
+// with reading from the returned stream; if no thread can be started, this
+// silently falls back to decompression on demand.
+//
+// Throws std::runtime_error if gringo has been built without zlib.
+// Reading from the returned stream throws std::runtime_error if the input
+// is corrupt.
+std::unique_ptr<std::istream> decompress(std::unique_ptr<std::istream> in, bool threaded = true);
+
+} // namespace Gringo
+
+#endif // _GRINGO_DECOMPRESS_HH
@@ -26,6 +26,7 @@
 #define _GRINGO_DOMAIN_HH
 
 #include <cassert>
+#include <cstring>
 #include <gringo/base.hh>
 #include <gringo/types.hh>
 #include <deque>
@@ -61,9 +62,121 @@ public:
 
 using SValVec = std::vector<Term::SVal>;
 
+// }}}
+// {{{ declaration of GenerationSplits
+
+// Records where atoms of a new generation start in a sequence of atom offsets
+// sorted by generation. This allows for splitting the sequence into old and
+// new atoms without accessing the atoms in the domain.
+class GenerationSplits {
+public:
+    // The position where atoms of a generation start.
+    struct Split {
+        Id_t generation;
+        Id_t position;
+    };
+    // Registers that an atom with the given generation has been appended at
+    // the given position.
+    void push(Id_t generation, Id_t position) {
+        if (splits_.empty() || splits_.back().generation != generation) {
+            splits_.push_back({generation, position});
+        }
+    }
+    // Returns the position of the first atom with a generation greater or
+    // equal to the given one (or size if there is no such atom).
+    Id_t split(Id_t generation, Id_t size) const {
+        return find(splits_.data(), splits_.data() + splits_.size(), generation, size);
+    }
+    // Sets the generation of all atoms back to zero (see AbstractDomain::init).
+    void reset(Id_t size) {
+        splits_.clear();
+        if (size > 0) { splits_.push_back({0, 0}); }
+    }
+    void swap(GenerationSplits &x) {
+        splits_.swap(x.splits_);
+    }
+    // Like split but for splits stored elsewhere (see BindIndexEntry).
+    static Id_t find(Split const *begin, Split const *end, Id_t generation, Id_t size) {
+        // Note: lookups typically ask for the latest generations
+        auto it = end;
+        for (; it != begin && (it - 1)->generation >= generation; --it) { }
+        return it != end ? it->position : size;
+    }
+
+private:
+    std::vector<Split> splits_;
+};
+
+// }}}
+// {{{ declaration of MembershipFilter
+
+// Counts lookups guarded by membership filters.
+struct FilterStats {
+    void add(FilterStats const &x) {
+        lookups += x.lookups;
+        rejected += x.rejected;
+        misses += x.misses;
+    }
+    // all guarded lookups
+    uint64_t lookups = 0;
+    // lookups answered by the filter without probing the hash table
+    uint64_t rejected = 0;
+    // lookups passing the filter that did not find the key
+    uint64_t misses = 0;
+};
+
+// A Bloom filter over the hashes of the keys stored in a hash table.
+// It rules out most lookups of absent keys without touching the table.
+// Both bits of a key are placed in the same word so that a test accesses
+// a single word. The filter has to be rebuilt with a larger size once
+// insert reports that it is full.
+class MembershipFilter {
+public:
+    // Adds a key given by its hash.
+    // Returns false if the key has not been added because the filter is full.
+    bool insert(size_t hash) {
+        if (size_ >= capacity_) { return false; }
+        ++size_;
+        auto h = Detail::hash_mix(static_cast<uint64_t>(hash));
+        words_[index(h)] |= mask(h);
+        return true;
+    }
+    // Returns false if the key is definitely not contained.
+    bool mayContain(size_t hash) const {
+        if (size_ == 0) { return false; }
+        auto h = Detail::hash_mix(static_cast<uint64_t>(hash));
+        auto m = mask(h);
+        return (words_[index(h)] & m) == m;
+    }
+    // Clears the filter making room for at least twice the given number of keys.
+    void reset(size_t size) {
+        size_t words = minWords;
+        while (words * keysPerWord < 2 * size) { words *= 2; }
+        words_.assign(words, 0);
+        capacity_ = words * keysPerWord;
+        size_ = 0;
+    }
+    void clear() {
+        std::vector<uint64_t>().swap(words_);
+        capacity_ = size_ = 0;
+    }
+
+private:
+    static constexpr size_t keysPerWord = 4;
+    static constexpr size_t minWords = 8;
+    size_t index(uint64_t h) const { return static_cast<size_t>(h >> 32) & (words_.size() - 1); }
+    static uint64_t mask(uint64_t h) { return (uint64_t(1) << (h & 63)) | (uint64_t(1) << ((h >> 6) & 63)); }
+
+    std::vector<uint64_t> words_;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+};
+
 // }}}
 // {{{ declaration of BindIndex
 
+// The entry stores the bound values, the offsets of the matching atoms, and
+// the generation splits of the offsets (see GenerationSplits) in one block.
 template <class Domain>
 class BindIndexEntry {
 public:
@@ -73,12 +186,15 @@ public:
     };
     using SizeType  = typename Domain::SizeType;
     using DataVec = std::vector<uint64_t>;
+    using Split = GenerationSplits::Split;
     BindIndexEntry(SymVec const &bound)
     : end_(0)
     , reserved_(1)
+    , splitsEnd_(0)
+    , splitsReserved_(1)
     , data_(nullptr)
     , begin_(nullptr) {
-        data_ = reinterpret_cast<uint64_t*>(malloc(sizeof(uint64_t) * bound.size() + sizeof(SizeType)));
+        data_ = reinterpret_cast<uint64_t*>(malloc(sizeof(uint64_t) * bound.size() + sizeof(SizeType) + sizeof(Split)));
         if (!data_) { throw std::bad_alloc(); }
         begin_ = reinterpret_cast<SizeType*>(data_ + bound.size());
         uint64_t *it = data_;
@@ -88,6 +204,8 @@ public:
     BindIndexEntry(BindIndexEntry &&e)
     : end_(0)
     , reserved_(0)
+    , splitsEnd_(0)
+    , splitsReserved_(0)
     , data_(nullptr)
     , begin_(nullptr) { *this = std::move(e); }
     BindIndexEntry &operator=(BindIndexEntry const &) = delete;
@@ -96,26 +214,28 @@ public:
         std::swap(begin_, e.begin_);
         std::swap(end_, e.end_);
         std::swap(reserved_, e.reserved_);
+        std::swap(splitsEnd_, e.splitsEnd_);
+        std::swap(splitsReserved_, e.splitsReserved_);
         return *this;
     }
     ~BindIndexEntry() { free(data_); }
     SizeType const *begin() const { return begin_; }
     SizeType const *end() const { return begin_ + end_; }
-    void push(SizeType x) {
+    // Returns the position of the first atom with the given or a later generation.
+    SizeType const *split(Id_t generation) const {
+        return begin_ + GenerationSplits::find(splits(), splits() + splitsEnd_, generation, end_);
+    }
+    void reset() {
+        splitsEnd_ = 0;
+        if (end_ > 0) { splits()[splitsEnd_++] = {0, 0}; }
+    }
+    void push(SizeType x, Id_t generation) {
         assert(reserved_ > 0 && end_ <= reserved_);
-        if (end_ == reserved_) {
-            size_t bound = reinterpret_cast<uint64_t const*>(begin_) - data_;
-            size_t oldsize = sizeof(uint64_t) * bound + sizeof(SizeType) * end_;
-            size_t size = oldsize + sizeof(SizeType) * end_;
-            if (size < oldsize) { throw std::runtime_error("size limit exceeded"); }
-            uint64_t *ret = reinterpret_cast<uint64_t*>(realloc(data_, size));
-            if (!ret) { throw std::bad_alloc(); }
-            reserved_ = 2 * end_;
-            if (data_ != ret) {
-                data_ = ret;
-                begin_ = reinterpret_cast<SizeType*>(data_ + bound);
-            }
+        bool split = splitsEnd_ == 0 || splits()[splitsEnd_ - 1].generation != generation;
+        if (end_ == reserved_ || (split && splitsEnd_ == splitsReserved_)) {
+            grow(end_ == reserved_ ? 2 * reserved_ : reserved_, split && splitsEnd_ == splitsReserved_ ? 2 * splitsReserved_ : splitsReserved_);
         }
+        if (split) { splits()[splitsEnd_++] = {generation, end_}; }
         begin_[end_++] = x;
     }
     size_t hash() const {
@@ -128,14 +248,40 @@ public:
         return std::equal(vec.begin(), vec.end(), data_, [](Symbol const &a, uint64_t b) { return a.rep() == b; });
     }
 private:
+    // The splits are stored after the reserved offsets.
+    Split *splits() const { return reinterpret_cast<Split*>(begin_ + reserved_); }
+    // Enlarges the block moving the splits behind the enlarged offsets.
+    void grow(Id_t reserved, Id_t splitsReserved) {
+        size_t bound = reinterpret_cast<uint64_t const*>(begin_) - data_;
+        size_t oldsize = sizeof(uint64_t) * bound + sizeof(SizeType) * reserved_ + sizeof(Split) * splitsReserved_;
+        size_t size = sizeof(uint64_t) * bound + sizeof(SizeType) * reserved + sizeof(Split) * splitsReserved;
+        if (reserved < reserved_ || splitsReserved < splitsReserved_ || size < oldsize) { throw std::runtime_error("size limit exceeded"); }
+        uint64_t *ret = reinterpret_cast<uint64_t*>(realloc(data_, size));
+        if (!ret) { throw std::bad_alloc(); }
+        data_ = ret;
+        begin_ = reinterpret_cast<SizeType*>(data_ + bound);
+        Split *splits = this->splits();
+        reserved_ = reserved;
+        splitsReserved_ = splitsReserved;
+        std::memmove(this->splits(), splits, sizeof(Split) * splitsEnd_);
+    }
+
     Id_t end_;
     Id_t reserved_;
+    Id_t splitsEnd_;
+    Id_t splitsReserved_;
     uint64_t* data_;
     SizeType* begin_;
 };
 
 // An index for a positive literal occurrence
 // with at least one variable bound and one variable unbound.
+//
+// As long as only few atoms match the occurrence, the index just records
+// their offsets and lookups scan them filtering by the bound variables. Only
+// once the number of matching atoms exceeds scanThreshold, the hash index is
+// materialized. This avoids building (and probing) hash tables for the many
+// occurrences over small domains.
 template <class Domain>
 class BindIndex : public IndexUpdater {
 public:
@@ -143,19 +289,22 @@ public:
     using OffsetVec = std::vector<SizeType>;
     using Iterator  = SizeType const *;
     using Entry     = BindIndexEntry<Domain>;
-    using Index     = UniqueVec<Entry, typename Entry::Hash, EqualTo>;
+    using Index     = UniqueVec<Entry, typename Entry::Hash, EqualTo, HugePageAllocator<Entry>>;
+
+    static constexpr SizeType scanThreshold = 32;
 
     struct OffsetRange {
         bool next(Id_t &offset, Term const &repr, BindIndex &idx) {
-            if (current != end) {
+            while (current != end) {
                 offset = *current++;
-                repr.match(idx.domain_[offset]);
-                return true;
+                // Note: in scan mode matching also checks the bound variables
+                if (repr.match(idx.domain_[offset]) || !scan) { return true; }
             }
             return false;
         }
         Iterator current;
         Iterator end;
+        bool scan;
     };
 
     BindIndex(Domain &domain, SValVec &&bound, UTerm &&repr)
@@ -166,23 +315,44 @@ public:
     }
 
     bool update() override {
-        return domain_.update([this](SizeType offset) { add(offset); }, *repr_, imported_, importedDelayed_);
+        checkEpoch();
+        bool ret = domain_.update([this](SizeType offset) {
+            if (indexed()) { add(offset); }
+            else {
+                scanGens_.push(domain_[offset].generation(), static_cast<Id_t>(scan_.size()));
+                scan_.emplace_back(offset);
+            }
+        }, *repr_, imported_, importedDelayed_);
+        if (!indexed() && scan_.size() > scanThreshold) { materialize(); }
+        return ret;
     }
 
     // Returns a range of offsets corresponding to atoms that match the given bound variables.
     OffsetRange lookup(SValVec const &bound, BinderType type, Logger &) {
+        checkEpoch();
+        if (!indexed()) {
+            auto begin = scan_.data(), end = begin + scan_.size();
+            return range(begin, begin + scanGens_.split(domain_.generation(), static_cast<Id_t>(scan_.size())), end, type, true);
+        }
         boundVals_.clear();
         for (auto &&x : bound) { boundVals_.emplace_back(*x); }
+        auto &stats = domain_.filterStats();
+        ++stats.lookups;
+        if (!filter_.mayContain(typename Entry::Hash()(boundVals_))) {
+            ++stats.rejected;
+            return { nullptr, nullptr, false };
+        }
         auto it(data_.find(boundVals_));
         if (it != data_.end()) {
-            auto cmp = [this](SizeType a, SizeType gen) { return domain_[a].generation() < gen; };
-            switch (type) {
-                case BinderType::NEW: { return { std::lower_bound(it->begin(), it->end(), domain_.generation(), cmp), it->end() }; }
-                case BinderType::OLD: { return { it->begin(), std::lower_bound(it->begin(), it->end(), domain_.generation(), cmp) }; }
-                case BinderType::ALL: { return { it->begin(), it->end() }; }
-            }
+            return range(it->begin(), it->split(domain_.generation()), it->end(), type, false);
         }
-        return { nullptr, nullptr };
+        ++stats.misses;
+        return { nullptr, nullptr, false };
+    }
+
+    // Whether the hash index has been materialized.
+    bool indexed() const {
+        return indexed_;
     }
 
     // The equality and hash functions are used to prevent adding structurally equivalent indices twice.
@@ -197,13 +367,49 @@ public:
     virtual ~BindIndex() noexcept = default;
 
 private:
+    // Restricts the given offsets to the atoms of the requested generations.
+    // Offsets before split belong to old and the remaining ones to new atoms.
+    OffsetRange range(Iterator begin, Iterator split, Iterator end, BinderType type, bool scan) {
+        switch (type) {
+            case BinderType::NEW: { return { split, end, scan }; }
+            case BinderType::OLD: { return { begin, split, scan }; }
+            case BinderType::ALL: { return { begin, end, scan }; }
+        }
+        throw std::logic_error("cannot happen");
+    }
+
+    // Resets the recorded generations if the domain has been reinitialized.
+    void checkEpoch() {
+        if (epoch_ != domain_.epoch()) {
+            epoch_ = domain_.epoch();
+            scanGens_.reset(static_cast<Id_t>(scan_.size()));
+            for (auto &entry : data_) { entry.reset(); }
+        }
+    }
+
+    // Moves the scanned offsets into the hash index.
+    // The offsets are added in order to preserve the generation order.
+    void materialize() {
+        indexed_ = true;
+        for (auto offset : scan_) {
+            repr_->match(domain_[offset]);
+            add(offset);
+        }
+        OffsetVec().swap(scan_);
+        GenerationSplits().swap(scanGens_);
+    }
+
     // Adds an atom given by its offset to the index.
     // Assumes that the atom matches and has not been added previously.
     void add(Id_t offset) {
         boundVals_.clear();
         for (auto &y : bound_) { boundVals_.emplace_back(*y); }
-        auto jt = data_.findPush(boundVals_, boundVals_).first;
-        jt->push(offset);
+        auto jt = data_.findPush(boundVals_, boundVals_);
+        if (jt.second && !filter_.insert(jt.first->hash())) {
+            filter_.reset(data_.size());
+            for (auto &entry : data_) { filter_.insert(entry.hash()); }
+        }
+        jt.first->push(offset, domain_[offset].generation());
     }
 
 private:
@@ -212,10 +418,18 @@ private:
     SValVec     bound_;
     SymVec      boundVals_;
     Index       data_;
+    MembershipFilter filter_;
+    OffsetVec   scan_;
+    GenerationSplits scanGens_;
     Id_t        imported_ = 0;
     Id_t        importedDelayed_ = 0;
+    Id_t        epoch_ = 0;
+    bool        indexed_ = false;
 };
 
+template <class Domain>
+constexpr typename BindIndex<Domain>::SizeType BindIndex<Domain>::scanThreshold;
+
 // }}}
 // {{{ declaration of FullIndex
 
@@ -360,7 +574,7 @@ template <class T>
 class AbstractDomain : public Domain {
 public:
     using Atom            = T;
-    using Atoms           = UniqueVec<Atom, HashKey<Symbol>, EqualToKey<Symbol>>;
+    using Atoms           = UniqueVec<Atom, HashKey<Symbol>, EqualToKey<Symbol>, HugePageAllocator<Atom>>;
     using BindIndex       = Gringo::BindIndex<AbstractDomain>;
     using FullIndex       = Gringo::FullIndex<AbstractDomain>;
     using BindIndices     = std::unordered_set<BindIndex, call_hash<BindIndex>>;
@@ -390,13 +604,23 @@ public:
         return idx;
     }
 
+    // Returns the number of indices registered with the domain.
+    size_t numIndices() const { return indices_.size() + fullIndices_.size(); }
+
     // Function to lookup negative literals or non-recursive atoms.
     bool lookup(SizeType &offset, Term const &repr, RECNAF naf, Logger &log) {
         bool undefined = false;
+        Symbol x = repr.eval(undefined, log);
+        return lookup(offset, x, undefined, naf);
+    }
+
+    // Function to lookup negative literals or non-recursive atoms given the
+    // evaluated representation of the literal.
+    bool lookup(SizeType &offset, Symbol x, bool undefined, RECNAF naf) {
         switch (naf) {
             case RECNAF::POS: {
                 // Note: intended for non-recursive case only
-                auto it = atoms_.find(repr.eval(undefined, log));
+                auto it = find(x);
                 if (!undefined && it != atoms_.end() && it->defined()) {
                     offset = static_cast<SizeType>(it - begin());
                     return true;
@@ -404,7 +628,7 @@ public:
                 break;
             }
             case RECNAF::NOT: {
-                auto it = atoms_.find(repr.eval(undefined, log));
+                auto it = find(x);
                 if (!undefined && it != atoms_.end()) {
                     if (!it->fact()) {
                         offset = static_cast<SizeType>(it - begin());
@@ -420,7 +644,7 @@ public:
                 break;
             }
             case RECNAF::RECNOT: {
-                auto it = reserve(repr.eval(undefined, log));
+                auto it = reserve(x);
                 if (!undefined && !it->fact()) {
                     offset = static_cast<SizeType>(it - begin());
                     return true;
@@ -429,7 +653,7 @@ public:
             }
             case RECNAF::NOTNOT: {
                 // Note: intended for recursive case only
-                auto it = reserve(repr.eval(undefined, log));
+                auto it = reserve(x);
                 if (!undefined) {
                     offset = static_cast<SizeType>(it - begin());
                     return true;
@@ -443,9 +667,16 @@ public:
 
     // Function to lookup recursive atoms.
     bool lookup(SizeType &offset, Term const &repr, BinderType type, Logger &log) {
-        // Note: intended for recursive case only
         bool undefined = false;
-        auto it = atoms_.find(repr.eval(undefined, log));
+        Symbol x = repr.eval(undefined, log);
+        return lookup(offset, x, undefined, type);
+    }
+
+    // Function to lookup recursive atoms given the evaluated representation
+    // of the literal.
+    bool lookup(SizeType &offset, Symbol x, bool undefined, BinderType type) {
+        // Note: intended for recursive case only
+        auto it = find(x);
         if (!undefined && it != atoms_.end() && it->defined()) {
             switch (type) {
                 case BinderType::OLD: {
@@ -505,6 +736,7 @@ public:
 
     void clear() {
         atoms_.clear();
+        filter_.clear();
         indices_.clear();
         fullIndices_.clear();
         generation_ = 0;
@@ -518,13 +750,21 @@ public:
     // The generation corresponds to the number of grounding iterations
     // the domain was involved in.
     SizeType generation() const { return generation_; }
+    // Returns the number of times the domain has been initialized.
+    // Indices use this to detect that generations have been reset.
+    Id_t epoch() const { return epoch_; }
     // Resevers an atom for a recursive negative literal.
     // This does not set a generation.
-    Iterator reserve(Symbol x) { return atoms_.findPush(x, x).first; }
+    Iterator reserve(Symbol x) {
+        auto ret = atoms_.findPush(x, x);
+        if (ret.second) { filterInsert(x); }
+        return ret.first;
+    }
     // Defines (adds) an atom setting its generation.
     std::pair<Iterator, bool> define(Symbol value) {
         auto ret = atoms_.findPush(value, value);
         if (ret.second) {
+            filterInsert(value);
             ret.first->setGeneration(generation() + 1);
         }
         else if (!ret.first->defined()) {
@@ -547,6 +787,7 @@ public:
     }
     // Sets the generation of the domain and all atoms back to zero.
     void init() override {
+        ++epoch_;
         generation_ = 0;
         for (auto it = begin() + initOffset_, ie = end(); it != ie; ++it) {
             if (it->defined()) { it->setGeneration(0); }
@@ -569,7 +810,26 @@ public:
     bool isEnqueued() const override { return enqueued_ > 0; }
     void nextGeneration() override { ++generation_; }
     OffsetVec &delayed() { return delayed_; }
-    Iterator find(Symbol x) { return atoms_.find(x); }
+    // Looks up an atom probing the hash table only if the filter admits it.
+    Iterator find(Symbol x) {
+        ++filterStats_.lookups;
+        if (!filter_.mayContain(x.hash())) {
+            ++filterStats_.rejected;
+            return atoms_.end();
+        }
+        auto it = atoms_.find(x);
+        if (it == atoms_.end()) { ++filterStats_.misses; }
+        return it;
+    }
+    // Prefetches the memory accessed first when looking up the given atom.
+    // Atoms ruled out by the filter are not prefetched.
+    void prefetch(Symbol x) {
+        if (filter_.mayContain(x.hash())) { atoms_.prefetch(x); }
+    }
+    // Statistics about lookups in the domain and its bind indices.
+    // The counters accumulate over the lifetime of the domain.
+    FilterStats &filterStats() { return filterStats_; }
+    FilterStats const &filterStats() const { return filterStats_; }
     ConstIterator find(Symbol x) const { return atoms_.find(x); }
     Id_t size() const { return atoms_.size(); }
     Iterator begin() { return atoms_.begin(); }
@@ -583,14 +843,25 @@ public:
     virtual ~AbstractDomain() noexcept { }
 protected:
     void hide(Iterator it) { atoms_.hide(it); }
+    void filterInsert(Symbol x) {
+        if (!filter_.insert(x.hash())) { rebuildFilter(); }
+    }
+    // Has to be called after atoms have been removed from the domain.
+    void rebuildFilter() {
+        filter_.reset(atoms_.size());
+        for (auto &atom : atoms_) { filter_.insert(static_cast<Symbol>(atom).hash()); }
+    }
 
 protected:
     BindIndices indices_;
     FullIndices fullIndices_;
     Atoms       atoms_;
+    MembershipFilter filter_;
+    FilterStats filterStats_;
     OffsetVec   delayed_;
     Id_t        enqueued_ = 0;
     Id_t        generation_ = 0;
+    Id_t        epoch_ = 0;
     Id_t        initOffset_ = 0;
     Id_t        initDelayedOffset_ = 0;
     Id_t        domainOffset_ = InvalidId;
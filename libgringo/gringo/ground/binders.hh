@@ -30,6 +30,27 @@
 
 namespace Gringo { namespace Ground {
 
+// {{{ definition of printIndex
+
+// Prints how lookups in an index are performed.
+template <class Index>
+inline void printIndex(std::ostream &, Index const &) { }
+
+template <class Domain>
+inline void printIndex(std::ostream &out, BindIndex<Domain> const &idx) {
+    out << (idx.indexed() ? "[index]" : "[scan]");
+}
+
+template <class Index>
+inline char const *indexKind(Index const &) { return "index"; }
+
+template <class Domain>
+inline char const *indexKind(BindIndex<Domain> const &idx) { return idx.indexed() ? "bind-index" : "bind-scan"; }
+
+template <class Domain>
+inline char const *indexKind(FullIndex<Domain> const &) { return "full-index"; }
+
+// }}}
 // {{{ definition of PosBinder
 
 template <class Index, class... LookupArgs>
@@ -55,7 +76,12 @@ struct PosBinder : Binder {
     IndexUpdater *getUpdater() override          { return &std::get<0>(index); }
     void match(Logger &log) override     { current = lookup<sizeof...(LookupArgs)>()(index, type, log); }
     bool next() override                         { return current.next(result, *repr, std::get<0>(index)); }
-    void print(std::ostream &out) const override { out << *repr << "@" << type; }
+    void print(std::ostream &out) const override {
+        out << *repr;
+        printIndex(out, std::get<0>(index));
+        out << "@" << type;
+    }
+    char const *kind() const override { return indexKind(std::get<0>(index)); }
     virtual ~PosBinder()                         { }
 
     UTerm      repr; // problematic
@@ -68,6 +94,15 @@ struct PosBinder : Binder {
 // }}}
 // {{{ definition of Matcher
 
+// Whether evaluating the term only substitutes the values of variables.
+// Lookups of such terms can be prefetched because evaluating them neither
+// calls scripts nor reports warnings (see Instantiator::finalize).
+inline bool plainTerm(Term const &term) {
+    if (dynamic_cast<ValTerm const *>(&term) || dynamic_cast<VarTerm const *>(&term)) { return true; }
+    auto fun = dynamic_cast<FunctionTerm const *>(&term);
+    return fun && std::all_of(fun->args.begin(), fun->args.end(), [](UTerm const &arg) { return plainTerm(*arg); });
+}
+
 template <class Atom>
 struct Matcher : Binder {
     using DomainType = AbstractDomain<Atom>;
@@ -77,10 +112,23 @@ struct Matcher : Binder {
         : result(result)
         , domain(domain)
         , repr(repr)
-        , naf(naf) { }
+        , naf(naf)
+        , plain(plainTerm(repr)) { }
     IndexUpdater *getUpdater() override { return nullptr; }
+    bool prefetchable() const override { return plain; }
+    void prefetch(Logger &log) override {
+        undefined = false;
+        value = repr.eval(undefined, log);
+        if (!undefined) { domain.prefetch(value); }
+        prefetched = true;
+    }
     void match(Logger &log) override {
-        firstMatch = domain.lookup(result, repr, naf, log);
+        if (!prefetched) {
+            undefined = false;
+            value = repr.eval(undefined, log);
+        }
+        prefetched = false;
+        firstMatch = domain.lookup(result, value, undefined, naf);
     }
     bool next() override {
         bool ret = firstMatch;
@@ -90,12 +138,17 @@ struct Matcher : Binder {
     void print(std::ostream &out) const override {
         out << naf << repr << "[" << domain.generation() << "/" << domain.size() << "]" << "@ALL";
     }
+    char const *kind() const override { return "lookup"; }
     virtual ~Matcher() { }
 
     Match      &result;
     DomainType &domain;
     Term const &repr;
     RECNAF      naf;
+    bool        plain;
+    Symbol      value;
+    bool        undefined = false;
+    bool        prefetched = false;
     bool        firstMatch;
 };
 
@@ -111,10 +164,23 @@ struct PosMatcher : Binder, IndexUpdater {
         : result(result)
         , domain(domain)
         , repr(std::move(repr))
-        , type(type) { }
+        , type(type)
+        , plain(plainTerm(*this->repr)) { }
     IndexUpdater *getUpdater() override { return type == BinderType::NEW ? this : nullptr; }
+    bool prefetchable() const override { return plain; }
+    void prefetch(Logger &log) override {
+        undefined = false;
+        value = repr->eval(undefined, log);
+        if (!undefined) { domain.prefetch(value); }
+        prefetched = true;
+    }
     void match(Logger &log) override {
-        firstMatch = domain.lookup(result, *repr, type, log);
+        if (!prefetched) {
+            undefined = false;
+            value = repr->eval(undefined, log);
+        }
+        prefetched = false;
+        firstMatch = domain.lookup(result, value, undefined, type);
     }
     bool next() override {
         bool ret = firstMatch;
@@ -123,6 +189,7 @@ struct PosMatcher : Binder, IndexUpdater {
     }
     bool update() override { return domain.update([](unsigned) { }, *repr, imported, importedDelayed); }
     void print(std::ostream &out) const override { out << *repr << "[" << domain.generation() << "/" << domain.size() << "]" << "@" << type; }
+    char const *kind() const override { return "lookup"; }
     virtual ~PosMatcher() { };
 
     Match      &result;
@@ -131,6 +198,10 @@ struct PosMatcher : Binder, IndexUpdater {
     BinderType  type;
     unsigned    imported = 0;
     unsigned    importedDelayed = 0;
+    bool        plain;
+    Symbol      value;
+    bool        undefined = false;
+    bool        prefetched = false;
     bool        firstMatch = false;
 };
 
@@ -164,8 +235,15 @@ inline UIdx make_binder(AbstractDomain<Atom> &domain, NAF naf, Term const &repr,
                 if (x.first->bindRef)                               { x.first->bindRef = bound.emplace(x.first->name).second; }
                 else if (occBoundSet.emplace(x.first->name).second) { occBound.emplace_back(*x.first); }
             }
+            // The representation of the index is made canonical by renaming
+            // its variables by position and boundness and dropping their
+            // nesting levels. This way equivalent occurrences in different
+            // statements share the same index.
             Term::RenameMap rename;
             UTerm idxClone(predClone->renameVars(rename));
+            VarTermBoundVec idxOccs;
+            idxClone->collect(idxOccs, false);
+            for (auto &x : idxOccs) { x.first->level = 0; }
             SValVec predBound, idxBound;
             for (VarTerm &x : occBound) {
                 auto it(rename.find(x.name));
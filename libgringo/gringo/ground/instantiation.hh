@@ -26,6 +26,7 @@
 #define _GRINGO_GROUND_INSTANTIATION_HH
 
 #include <gringo/output/types.hh>
+#include <unordered_map>
 
 namespace Gringo { namespace Ground {
 
@@ -43,6 +44,8 @@ struct Queue {
     QueueDec  current;
     std::array<QueueDec,2>  queues;
     DomainVec domains;
+    // If set, collects the instantiators in the order they are first processed.
+    QueueDec *explained = nullptr;
 };
 
 // }}}
@@ -52,6 +55,13 @@ struct Binder : Printable {
     virtual IndexUpdater *getUpdater() = 0;
     virtual void match(Logger &log) = 0;
     virtual bool next() = 0;
+    // Binders that do not bind variables and whose lookup can be evaluated
+    // without side effects can evaluate it in advance and prefetch the memory
+    // the following call to match accesses.
+    virtual bool prefetchable() const { return false; }
+    virtual void prefetch(Logger &) { }
+    // A short description of how the binder obtains its matches.
+    virtual char const *kind() const { return "match"; }
     virtual ~Binder() { }
 };
 using UIdx = std::unique_ptr<Binder>;
@@ -95,6 +105,33 @@ struct BackjumpBinder {
 
     UIdx index;
     DependVec depends;
+    // The binders to prefetch before matching (see Instantiator::finalize).
+    std::vector<Binder*> batch;
+    // The estimate used when ordering the body and, if the grounding is
+    // explained, the number of times the binder has been matched and
+    // produced a binding.
+    double estimate = 0;
+    uint64_t matches = 0;
+    uint64_t bindings = 0;
+    bool explain = false;
+    // The variables bound and the previously bound variables used by the
+    // binder. If failures are memoized at this position, the preceding
+    // binders and variables the remaining body depends on (see
+    // Instantiator::memoizeFailures).
+    SValVec binds;
+    SValVec uses;
+    DependVec memoDepends;
+    SValVec memoVars;
+    bool memoizable = false;
+    bool memoize = false;
+    // The number of solutions reported when the binder was last entered.
+    uint64_t entered = 0;
+    // The memoized failures looked up and found during the current
+    // instantiation and, if the grounding is explained, in total.
+    uint64_t memoLookups = 0;
+    uint64_t memoHits = 0;
+    uint64_t memoLookupsTotal = 0;
+    uint64_t memoHitsTotal = 0;
     bool backjumpable = false;
 };
 inline std::ostream &operator<<(std::ostream &out, BackjumpBinder &x) { x.print(out); return out; }
@@ -104,21 +141,46 @@ inline std::ostream &operator<<(std::ostream &out, BackjumpBinder &x) { x.print(
 
 struct Instantiator {
     using DependVec = BackjumpBinder::DependVec;
+    struct FailureHash {
+        size_t operator()(SymVec const &x) const { return hash_range(x.begin(), x.end()); }
+    };
+    using FailureMap = std::unordered_map<SymVec, uint64_t, FailureHash>;
+    // Bounds the number of failures memoized during one instantiation.
+    static constexpr size_t maxFailures = 1 << 16;
 
     Instantiator(SolutionCallback &callback);
     Instantiator(Instantiator &&x) = default;
     Instantiator &operator=(Instantiator &&x) = default;
     void add(UIdx &&index, DependVec &&depends);
     void finalize(DependVec &&depends);
+    // Remembers bindings under which the remaining body has no solutions.
+    //
+    // Requires that the variables bound and used by each binder have been
+    // set. If the binders from some position on are exhausted without
+    // reporting a solution, the values of the preceding variables they depend
+    // on are recorded. Entering the position again with the same values then
+    // fails immediately. If the body is recursive, reported solutions can
+    // extend its domains and recorded failures expire whenever a solution is
+    // reported.
+    void memoizeFailures(bool recursive);
     void enqueue(Queue &queue);
     void instantiate(Output::OutputBase &out, Logger &log);
     void print(std::ostream &out) const;
+    void explain(std::ostream &out) const;
     unsigned priority() const;
     ~Instantiator() noexcept;
+    bool failed(BackjumpBinder &x, unsigned pos);
+    void recordFailure(BackjumpBinder &x, unsigned pos);
+    void setFailureKey(BackjumpBinder const &x, unsigned pos);
 
     SolutionCallback *callback;
     std::vector<BackjumpBinder> binders;
+    FailureMap failures;
+    SymVec failureKey;
+    uint64_t solutions = 0;
+    bool failuresExpire = false;
     bool enqueued = false;
+    bool explained = false;
 };
 using InstVec = std::vector<Instantiator>;
 inline std::ostream &operator<<(std::ostream &out, Instantiator &x) { x.print(out); return out; }
@@ -54,7 +54,9 @@ struct Program {
 
     Program(SEdbVec &&edb, Statement::Dep::ComponentVec &&stms, ClassicalNegationVec &&negate);
     void linearize(Context &context, Logger &log);
-    void ground(Parameters const &params, Context &context, Output::OutputBase &out, Logger &log);
+    // If explain is given, the join plan of each instantiator is printed
+    // together with estimated and actual bindings after grounding.
+    void ground(Parameters const &params, Context &context, Output::OutputBase &out, Logger &log, std::ostream *explain = nullptr);
 
     SEdbVec                      edb;
     bool                         linearized = false;
@@ -32,6 +32,7 @@
 #include <array>
 #include <gringo/primes.hh>
 #include <gringo/utility.hh>
+#include <gringo/hugepages.hh>
 
 // This shoud really be benchmarked on a large set of problems.
 // I would expect double hashing to be more robust but slower than linear probing.
@@ -40,6 +41,12 @@
 // Double hashing is supposed to work with especially high load factors.
 #define GRINGO_PROBE_LINEAR
 
+#if defined(__GNUC__) || defined(__clang__)
+#   define GRINGO_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#   define GRINGO_PREFETCH(addr) static_cast<void>(addr)
+#endif
+
 namespace Gringo {
 
 template <typename Value>
@@ -59,14 +66,14 @@ class HashSet {
 public:
     using ValueType = Value;
     using SizeType = uint32_t;
-    using TableType = std::unique_ptr<ValueType[]>;
+    using TableType = HugeArray<ValueType>;
 
     // at least n value can be inserted without reallocation
     // and the container is larger by a constant factor c > 1 than c*r
     HashSet(SizeType n = 0, SizeType r = 0) : size_(0), reserved_(0) {
         if (n > 0) {
             reserved_ = grow_(n, r);
-            table_.reset(new ValueType[reserved_]);
+            table_ = makeHugeArray<ValueType>(reserved_);
             std::fill(table_.get(), table_.get() + reserved_, Literals::open);
         }
     }
@@ -103,7 +110,7 @@ public:
             SizeType rNew = grow_(n, reserved_);
             assert(rOld < rNew);
             if (table_) {
-                TableType table(new ValueType[rNew]);
+                TableType table(makeHugeArray<ValueType>(rNew));
                 reserved_ = rNew;
                 std::fill(table.get(), table.get() + reserved_, Literals::open);
                 std::swap(table, table_);
@@ -112,7 +119,7 @@ public:
                 }
             }
             else {
-                table_.reset(new ValueType[rNew]);
+                table_ = makeHugeArray<ValueType>(rNew);
                 reserved_ = rNew;
                 std::fill(table_.get(), table_.get() + reserved_, Literals::open);
             }
@@ -123,6 +130,17 @@ public:
         auto ret = !empty() ? find_(hasher, equalTo, val...) : std::make_pair(nullptr, false);
         return ret.second ? ret.first : nullptr;
     }
+    // Prefetches the slot where the lookup of the given value starts probing.
+    template <typename Hasher, typename... Args>
+    void prefetch(Hasher const &hasher, Args const&... val) {
+        if (!empty()) {
+#ifdef GRINGO_PROBE_LINEAR
+            GRINGO_PREFETCH(&table_[hash_(hasher, val...)]);
+#else
+            GRINGO_PREFETCH(&table_[hash_(hasher, val...).first]);
+#endif
+        }
+    }
     template <typename Hasher, typename EqualTo, typename T>
     std::pair<ValueType&, bool> insert(Hasher const &hasher, EqualTo const &equalTo, T &&val) {
         reserve(hasher, equalTo, size() + 1);
@@ -293,11 +311,11 @@ using HashFirst = HashKey<T,First<T>,Hash>;
 template <typename T, typename EqualTo=std::equal_to<T>>
 using EqualToFirst = EqualToKey<T,First<T>,EqualTo>;
 
-template <typename Value, typename Hash=std::hash<Value>, typename EqualTo=std::equal_to<Value>>
+template <typename Value, typename Hash=std::hash<Value>, typename EqualTo=std::equal_to<Value>, typename Alloc=std::allocator<Value>>
 class UniqueVec : private Hash, private EqualTo {
 public:
     using SizeType = unsigned;
-    using Vec = std::vector<Value>;
+    using Vec = std::vector<Value, Alloc>;
     using Set = HashSet<SizeType>;
     using ValueType = Value;
     using Iterator = typename Vec::iterator;
@@ -346,6 +364,11 @@ public:
     ConstIterator find(U const &val) const {
         return const_cast<UniqueVec*>(this)->find(val);
     }
+    // Prefetches the memory accessed first when calling find with the given value.
+    template <class U>
+    void prefetch(U const &val) {
+        set_.prefetch([this, &val](SizeType) { return Hash::operator()(val); }, static_cast<SizeType>(vec_.size()));
+    }
     void pop() {
         assert(!vec_.empty());
         set_.erase(
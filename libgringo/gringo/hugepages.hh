@@ -0,0 +1,94 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#ifndef _GRINGO_HUGEPAGES_HH
+#define _GRINGO_HUGEPAGES_HH
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <limits>
+
+namespace Gringo {
+
+// Large and long-lived arrays like the atoms of a domain or the tables of
+// hash sets can be backed by transparent huge pages to reduce TLB misses
+// when they are probed randomly.
+//
+// The policy is initialized from the environment variable
+// GRINGO_HUGE_PAGES (0 to disable, 1 to enable) and disabled by default.
+// Allocations smaller than hugePageSize never use huge pages. If huge pages
+// are not available, the memory is allocated as usual.
+
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+bool hugePages();
+void setHugePages(bool enable);
+
+// Memory returned by allocHuge has to be freed with freeHuge.
+void *allocHuge(size_t size);
+void freeHuge(void *ptr) noexcept;
+
+template <class T>
+struct HugeArrayDeleter {
+    void operator()(T *ptr) const noexcept {
+        for (T *it = ptr, *ie = ptr + size; it != ie; ++it) { it->~T(); }
+        freeHuge(ptr);
+    }
+    size_t size = 0;
+};
+
+template <class T>
+using HugeArray = std::unique_ptr<T[], HugeArrayDeleter<T>>;
+
+template <class T>
+HugeArray<T> makeHugeArray(size_t n) {
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) { throw std::bad_alloc(); }
+    T *ptr = static_cast<T*>(allocHuge(n * sizeof(T)));
+    for (T *it = ptr, *ie = it + n; it != ie; ++it) { new (it) T; }
+    return HugeArray<T>(ptr, HugeArrayDeleter<T>{n});
+}
+
+template <class T>
+class HugePageAllocator {
+public:
+    using value_type = T;
+    HugePageAllocator() = default;
+    template <class U>
+    HugePageAllocator(HugePageAllocator<U> const &) { }
+    T *allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) { throw std::bad_alloc(); }
+        return static_cast<T*>(allocHuge(n * sizeof(T)));
+    }
+    void deallocate(T *ptr, size_t) noexcept { freeHuge(ptr); }
+    template <class U>
+    bool operator==(HugePageAllocator<U> const &) const { return true; }
+    template <class U>
+    bool operator!=(HugePageAllocator<U> const &) const { return false; }
+};
+
+} // namespace Gringo
+
+#endif // _GRINGO_HUGEPAGES_HH
@@ -39,6 +39,7 @@ class GroundTermParser : private LexerState<int> {
 public:
     GroundTermParser();
     Symbol parse(std::string const &str, Logger &log);
+    Symbol parse(char const *str, Logger &log);
     ~GroundTermParser();
     // NOTE: only to be used durning parsing (actually it would be better to hide this behind a private interface)
     Logger &logger() { assert(log_); return *log_; }
@@ -56,8 +57,14 @@ public:
     Symbol        value;
 private:
     int lex_impl(void *pValue, Logger &log);
+    // Fast path for numbers, identifiers, strings, and flat functions/tuples
+    // over these; returns false for anything else, which is then handled by
+    // the grammar.
+    bool parseSimple(char const *str, Symbol &ret);
+    bool parseAtom(char const *&it, Symbol &ret);
 
     IndexedTerms terms_;
+    SymVec       args_;
     Logger *log_ = nullptr;
     bool         undefined_;
 };
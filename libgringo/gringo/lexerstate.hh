@@ -34,7 +34,9 @@
 #include <fstream>
 #include <cassert>
 #include <memory>
+#include <thread>
 #include <potassco/basic_types.h>
+#include <gringo/decompress.hh>
 
 namespace Gringo {
 
@@ -213,20 +215,22 @@ bool LexerState<T>::push(std::unique_ptr<std::istream> in, T &&data) {
 
 template <class T>
 bool LexerState<T>::push(char const *file, T &&data) {
+    std::unique_ptr<std::istream> in;
     if (strcmp(file, "-") == 0) {
-        states_.emplace_back(std::forward<T>(data));
-        state().in_.reset(new std::istream(std::cin.rdbuf(0)));
-        return true;
+        in.reset(new std::istream(std::cin.rdbuf(0)));
     }
     else {
-        std::unique_ptr<std::ifstream> ifs(new std::ifstream(file));
-        if (ifs->is_open()) {
-            states_.emplace_back(std::forward<T>(data));
-            state().in_.reset(ifs.release());
-            return true;
-        }
-        else { return false; }
+        std::unique_ptr<std::ifstream> ifs(new std::ifstream(file, std::ios::binary));
+        if (!ifs->is_open()) { return false; }
+        in = std::move(ifs);
+    }
+    // gzip-compressed files are decompressed while lexing
+    if (isCompressed(*in)) {
+        in = decompress(std::move(in), std::thread::hardware_concurrency() > 1);
     }
+    states_.emplace_back(std::forward<T>(data));
+    state().in_ = std::move(in);
+    return true;
 }
 
 template <class T>
@@ -31,6 +31,8 @@
 #include <stdexcept>
 #include <memory>
 #include <functional>
+#include <map>
+#include <tuple>
 
 #include <iostream>
 
@@ -76,15 +78,38 @@ public:
     , limit_(limit) { }
     bool check(Errors id);
     bool check(Warnings id);
+    // Like check but, if aggregation is enabled, only the first message
+    // with the given code and location is reported; repetitions are just
+    // counted and reported in the summary (see summarize).
+    template <class Loc>
+    bool check(Warnings id, Loc const &loc);
     bool hasError() const;
     void enable(Warnings id, bool enable);
+    void aggregate(bool enable);
+    // Reports how often messages have been repeated since the last call.
+    void summarize();
     void print(Warnings code, char const *msg);
     ~Logger();
 private:
+    struct Occurrence {
+        Warnings code;
+        char const *beginFilename;
+        char const *endFilename;
+        unsigned beginLine;
+        unsigned endLine;
+        unsigned beginColumn;
+        unsigned endColumn;
+        bool operator<(Occurrence const &x) const {
+            return std::tie(code, beginLine, beginColumn, endLine, endColumn, beginFilename, endFilename) <
+                   std::tie(x.code, x.beginLine, x.beginColumn, x.endLine, x.endColumn, x.beginFilename, x.endFilename);
+        }
+    };
     Printer p_;
     unsigned limit_;
     std::bitset<static_cast<int>(Warnings::Other)+1> disabled_;
+    std::map<Occurrence, unsigned> repeated_;
     bool error_ = false;
+    bool aggregate_ = false;
 };
 
 // }}}1
@@ -104,6 +129,22 @@ inline bool Logger::check(Warnings id) {
     }
 }
 
+template <class Loc>
+inline bool Logger::check(Warnings id, Loc const &loc) {
+    if (!aggregate_ || id == Warnings::RuntimeError) { return check(id); }
+    if (disabled_[static_cast<int>(id)]) { return false; }
+    // NOTE: file names are unique strings and can be compared by address
+    Occurrence occ{id, loc.beginFilename.c_str(), loc.endFilename.c_str(), loc.beginLine, loc.endLine, loc.beginColumn, loc.endColumn};
+    // NOTE: repeated occurrences are only counted and must not allocate
+    auto it = repeated_.lower_bound(occ);
+    if (it != repeated_.end() && !repeated_.key_comp()(occ, it->first)) {
+        ++it->second;
+        return false;
+    }
+    repeated_.emplace_hint(it, occ, 0);
+    return check(id);
+}
+
 inline bool Logger::hasError() const {
     return error_;
 }
@@ -112,6 +153,37 @@ inline void Logger::enable(Warnings id, bool enabled) {
     disabled_[static_cast<int>(id)] = !enabled;
 }
 
+inline void Logger::aggregate(bool enable) {
+    aggregate_ = enable;
+}
+
+inline void Logger::summarize() {
+    std::map<Occurrence, unsigned> repeated;
+    repeated.swap(repeated_);
+    for (int i = 0; i <= static_cast<int>(Warnings::Other); ++i) {
+        auto code = static_cast<Warnings>(i);
+        std::ostringstream out;
+        for (auto &x : repeated) {
+            if (x.first.code != code || x.second == 0) { continue; }
+            auto &occ = x.first;
+            out << "  " << occ.beginFilename << ":" << occ.beginLine << ":" << occ.beginColumn;
+            if (occ.beginFilename != occ.endFilename) {
+                out << "-" << occ.endFilename << ":" << occ.endLine << ":" << occ.endColumn;
+            }
+            else if (occ.beginLine != occ.endLine) {
+                out << "-" << occ.endLine << ":" << occ.endColumn;
+            }
+            else if (occ.beginColumn != occ.endColumn) {
+                out << "-" << occ.endColumn;
+            }
+            out << ": " << x.second << " more time" << (x.second > 1 ? "s" : "") << "\n";
+        }
+        if (out.tellp() > 0 && check(code)) {
+            print(code, ("info: messages repeated at the following locations:\n" + out.str()).c_str());
+        }
+    }
+}
+
 inline void Logger::print(Warnings code, char const *msg) {
     if (p_) { p_(code, msg); }
     else {
@@ -142,5 +214,11 @@ private:
 if (!(p).check(id)) { } \
 else Gringo::Report(p, id).out
 
+// Like GRINGO_REPORT but repetitions of messages with the same location are
+// only counted if the logger aggregates messages.
+#define GRINGO_REPORT_LOC(p, id, loc) \
+if (!(p).check(id, loc)) { } \
+else Gringo::Report(p, id).out
+
 #endif // _GRINGO_REPORT_HH
 
@@ -252,6 +252,7 @@ public:
     void accumulate(DomainData &data, TupleId tuple, LitVec &lits, bool &inserted, bool &fact, bool &remove);
     // NOTE: expensive (linear)
     BodyAggregateElements elems() const;
+    Id_t size() const { return tuples_.size(); }
 
 private:
     std::pair<uint64_t &, bool> insertTuple(uint64_t to);
@@ -289,6 +290,7 @@ public:
     PlainBounds plainBounds() { return data_->range.plainBounds(); }
     bool recursive() const { return data_->recursive; }
     BodyAggregateElements elems() const;
+    Id_t numElems() const { return data_->elems.size(); }
     LiteralId lit() const { return data_->lit; }
     void setLit(LiteralId lit) { data_->lit = lit; }
     bool satisfiable() const { return data_->range.satisfiable(); }
@@ -771,6 +773,21 @@ public:
         showOffset_ = 0;
     }
 
+    // Atoms of projection domains that already have been output in a
+    // previous step must not be redefined. Such atoms, i.e., atoms that were
+    // not facts when the step started and have a uid less or equal to the
+    // given one, are given a fresh uid before being used in the current step
+    // (see PredicateLiteral::uid). Atoms becoming facts during the step are
+    // renewed before they are marked as facts (see Ground::Rule::report), so
+    // that only facts of previous steps are exempt.
+    void renewUids(Id_t uid) {
+        renewUid_ = uid;
+    }
+
+    bool needsRenewal(PredicateAtom const &atom) const {
+        return !atom.fact() && atom.uid() <= renewUid_ && atom.defined();
+    }
+
     Sig const &sig() const {
         return sig_;
     }
@@ -784,6 +801,7 @@ private:
     Sig sig_;
     SizeType incOffset_ = 0;
     SizeType showOffset_ = 0;
+    Id_t renewUid_ = 0;
 };
 using UPredDom = std::unique_ptr<PredicateDomain>;
 
@@ -1076,6 +1094,7 @@ enum class TheoryTermType : int {
 };
 
 class DomainData {
+    using RenewedVec = std::vector<std::pair<LiteralId, LiteralId>>;
     using Tuples = UniqueVecVec<2, Symbol>;
     using Clauses = UniqueVecVec<2, LiteralId>;
     using Formulas = UniqueVecVec<2, std::pair<Id_t,Id_t>, value_hash<std::pair<Id_t,Id_t>>>;
@@ -1097,6 +1116,12 @@ public:
     }
     PredDomMap &predDoms() { return predDomains_; }
     PredDomMap const &predDoms() const { return predDomains_; }
+    // Sums the lookup statistics of all predicate domains.
+    FilterStats filterStats() const {
+        FilterStats ret;
+        for (auto &dom : predDomains_) { ret.add(dom->filterStats()); }
+        return ret;
+    }
     PredicateDomain &predDom(Id_t offset) { return *predDomains_[offset]; }
     PredicateDomain const &predDom(Id_t offset) const { return *predDomains_[offset]; }
     template <class D, typename... Args>
@@ -1126,6 +1151,18 @@ public:
         return getDom<D const>(lit.domain())[lit.offset()];
     }
     Potassco::Atom_t newAtom() { return ++atoms_; }
+    Potassco::Atom_t maxAtom() const { return atoms_; }
+    // Assigns a fresh uid to an atom of a projection domain.
+    // The rules deriving the fresh atoms from the old ones are collected
+    // and have to be output afterwards (see OutputBase::outputRenewed).
+    Potassco::Atom_t renewUid(PredicateAtom &atom, Id_t domain) {
+        Potassco::Atom_t oldUid = atom.uid();
+        Potassco::Atom_t newUid = newAtom();
+        atom.resetUid(newUid);
+        renewed_.emplace_back(LiteralId{NAF::POS, AtomType::Aux, newUid, domain}, LiteralId{NAF::POS, AtomType::Aux, oldUid, domain});
+        return newUid;
+    }
+    RenewedVec &renewed() { return renewed_; }
     LiteralId newAux(NAF naf = NAF::POS) { return {naf, Gringo::Output::AtomType::Aux, newAtom(), 0}; }
     LiteralId newDelayed(NAF naf = NAF::POS) { return {naf, Gringo::Output::AtomType::Aux, newAtom(), 1}; }
     LiteralId getTrueLit() {
@@ -1217,6 +1254,7 @@ private:
     PredDomMap predDomains_;
     UDomVec domains_;
     Potassco::Atom_t atoms_ = 0;
+    RenewedVec renewed_;
     Clauses clauses_;
     Tuples tuples_;
     Formulas formulas_;
@@ -57,6 +57,16 @@ private:
     UBackend out_;
 };
 
+// Counts the statements of the ground program without translating them or
+// passing them to a backend (dry run).
+class CountOutput : public AbstractOutput {
+public:
+    CountOutput(std::ostream &stream);
+    void output(DomainData &data, Statement &stm) override;
+private:
+    StatementCounter counter_;
+};
+
 struct OutputOptions {
     OutputDebug debug      = OutputDebug::NONE;
     bool        reifySCCs  = false;
@@ -91,6 +101,8 @@ public:
     Backend *backend(Logger &logger);
     void registerObserver(UBackend prg, bool replace);
     void reset(bool resetData);
+    // Outputs the rules linking renewed projection atoms (see DomainData::renewUid).
+    void outputRenewed();
     Id_t addAtom(Symbol sym) {
         auto &atm = *data.add(sym.sig()).define(sym).first;
         if (!atm.hasUid()) { atm.setUid(data.newAtom()); }
@@ -30,6 +30,7 @@
 #include <gringo/locatable.hh>
 #include <gringo/symbol.hh>
 #include <gringo/domain.hh>
+#include <unordered_set>
 
 namespace Gringo { namespace Output {
 
@@ -42,6 +43,37 @@ public:
 };
 using UAbstractOutput = std::unique_ptr<AbstractOutput>;
 
+// {{{1 declaration of StatementCounter
+
+// Collects statistics about the ground program without translating it.
+// The byte figures are rough estimates of the memory a statement would
+// occupy in the output; elements of aggregates, conjunctions, disjunctions,
+// and theory atoms are counted once per atom. Lookups in predicate domains
+// and their indices are reported together with how many of them were
+// answered by membership filters (see FilterStats).
+class StatementCounter {
+public:
+    StatementCounter(std::ostream &out) : out_(out) { }
+    void rule(DomainData &data, LitVec const &head, LitVec const &body);
+    void statement(DomainData &data, LitVec const &body, unsigned size = 0);
+    void statement(DomainData &data, LiteralId lit, LitVec const &body, unsigned size = 0);
+    void literal(DomainData &data, LiteralId lit);
+    // Prints the statistics of the current step and resets the counters.
+    void endStep(DomainData &data);
+
+    uint64_t rules = 0;
+    uint64_t statements = 0;
+    uint64_t literals = 0;
+    uint64_t elements = 0;
+    uint64_t bytes = 0;
+
+private:
+    std::ostream &out_;
+    std::unordered_set<uint64_t> seen_;
+    // lookup statistics up to the previous step
+    FilterStats filter_;
+};
+
 // {{{1 declaration of Statement
 
 void replaceDelayed(DomainData &data, LiteralId &lit, LitVec &delayed);
@@ -56,6 +88,8 @@ public:
     virtual void print(PrintPlain out, char const *prefix = "") const = 0;
     virtual void translate(DomainData &data, Translator &trans) = 0;
     virtual void replaceDelayed(DomainData &data, LitVec &delayed) = 0;
+    // used by dry runs; statements not contributing to the program size are skipped
+    virtual void count(DomainData &, StatementCounter &) const { }
     // convenience function
     void passTo(DomainData &data, AbstractOutput &out) { out.output(data, *this); }
 };
@@ -37,6 +37,7 @@ public:
     Rule(bool choice = false);
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void translate(DomainData &data, Translator &trans) override;
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     Rule &reset(bool choice);
@@ -71,6 +72,7 @@ public:
     External(LiteralId head, Potassco::Value_t type);
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void translate(DomainData &data, Translator &trans) override;
     void output(DomainData &data, UBackend &out) const override;
     virtual ~External();
@@ -89,6 +91,7 @@ public:
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void translate(DomainData &data, Translator &trans) override;
     virtual ~ShowStatement() noexcept = default;
 
@@ -106,6 +109,7 @@ public:
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void translate(DomainData &data, Translator &trans) override;
     virtual ~ProjectStatement() noexcept = default;
 
@@ -121,6 +125,7 @@ public:
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void translate(DomainData &data, Translator &trans) override;
     virtual ~HeuristicStatement() noexcept = default;
 
@@ -140,6 +145,7 @@ public:
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void translate(DomainData &data, Translator &trans) override;
     virtual ~EdgeStatement() noexcept = default;
 
@@ -161,6 +167,7 @@ public:
     void translate(DomainData &data, Translator &x) override;
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     virtual ~WeakConstraint() noexcept = default;
 
@@ -177,6 +184,7 @@ public:
     void translate(DomainData &data, Translator &x) override;
     void output(DomainData &data, UBackend &out) const override;
     void print(PrintPlain out, char const *prefix) const override;
+    void count(DomainData &data, StatementCounter &counter) const override;
     void replaceDelayed(DomainData &data, LitVec &delayed) override;
     virtual ~TheoryDirective() noexcept = default;
 
@@ -298,6 +306,7 @@ private:
 public:
     using TupleLit        = std::pair<TupleId, LiteralId>;
     using MinimizeList    = std::vector<TupleLit>;
+    using MinimizeMap     = std::map<int, MinimizeList>;
     using BoundMap        = UniqueVec<Bound, HashKey<Symbol>, EqualToKey<Symbol>>;
     using ConstraintVec   = std::vector<LinearConstraint>;
     using DisjointConsVec = std::vector<LiteralId>;
@@ -305,7 +314,7 @@ public:
     using TupleLitMap     = UniqueVec<TupleLit, HashFirst<TupleId>, EqualToFirst<TupleId>>;
 
     Translator(UAbstractOutput &&out);
-    void addMinimize(TupleId tuple, LiteralId cond);
+    void addMinimize(int priority, TupleId tuple, LiteralId cond);
     void addBounds(Symbol value, std::vector<CSPBound> bounds);
     BoundMap::Iterator addBound(Symbol x);
     Bound &findBound(Symbol x);
@@ -341,7 +350,7 @@ private:
 
     OutputTable termOutput_;
     OutputTable cspOutput_;
-    MinimizeList minimize_;   // stores minimize constraint for current step
+    MinimizeMap minimize_;    // stores minimize constraint for current step by priority
     TupleLitMap tuples_;      // to incrementally extend minimize constraint
     BoundMap boundMap_;
     ConstraintVec constraints_;
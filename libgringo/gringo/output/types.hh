@@ -56,7 +56,7 @@ struct UPredDomEqualTo;
 using PredDomMap = UniqueVec<std::unique_ptr<PredicateDomain>, UPredDomHash, UPredDomEqualTo>;
 
 enum class OutputDebug { NONE, TEXT, TRANSLATE, ALL };
-enum class OutputFormat { TEXT, INTERMEDIATE, SMODELS, REIFY };
+enum class OutputFormat { TEXT, INTERMEDIATE, SMODELS, REIFY, COUNT };
 
 } } // namespace Output Gringo
 
@@ -191,6 +191,9 @@ public:
 
     // ouput
     void print(std::ostream& out) const;
+    // Appends the same text as print(std::ostream&) to the given string.
+    // (Meant for printing many symbols into a reused buffer.)
+    void print(std::string &out) const;
 
     uint64_t const &rep () const { return rep_; }
 private:
@@ -218,6 +218,12 @@ struct Term : public Printable, public Hashable, public Locatable, public Compar
     //! Evaluates the term to a value.
     //! \pre Must be called after simplify.
     virtual Symbol eval(bool &undefined, Logger &log) const = 0;
+    //! Evaluates integer arithmetics over numbers and bound variables
+    //! without constructing intermediate symbols.
+    //! Returns false if the term cannot be evaluated to a number this way;
+    //! then eval has to be used, which also reports undefined operations.
+    //! \pre Must be called after simplify.
+    virtual bool evalNum(int &num) const { (void)num; return false; }
     //! Returns true if the term evaluates to zero.
     //! \pre Must be called after simplify.
     //! \pre Term is ground or
@@ -488,6 +494,7 @@ struct ValTerm : public Term {
     virtual void collect(VarTermBoundVec &vars, bool bound) const;
     virtual void collect(VarSet &vars, unsigned minLevel = 0, unsigned maxLevel = std::numeric_limits<unsigned>::max()) const;
     virtual Symbol eval(bool &undefined, Logger &log) const;
+    virtual bool evalNum(int &num) const;
     virtual bool match(Symbol const &val) const;
     virtual Sig getSig() const;
     virtual UTerm renameVars(RenameMap &names) const;
@@ -526,6 +533,7 @@ struct VarTerm : Term {
     virtual void collect(VarTermBoundVec &vars, bool bound) const;
     virtual void collect(VarSet &vars, unsigned minLevel = 0, unsigned maxLevel = std::numeric_limits<unsigned>::max()) const;
     virtual Symbol eval(bool &undefined, Logger &log) const;
+    virtual bool evalNum(int &num) const;
     virtual bool match(Symbol const &val) const;
     virtual Sig getSig() const;
     virtual UTerm renameVars(RenameMap &names) const;
@@ -566,6 +574,7 @@ struct UnOpTerm : public Term {
     virtual void collect(VarTermBoundVec &vars, bool bound) const;
     virtual void collect(VarSet &vars, unsigned minLevel = 0, unsigned maxLevel = std::numeric_limits<unsigned>::max()) const;
     virtual Symbol eval(bool &undefined, Logger &log) const;
+    virtual bool evalNum(int &num) const;
     virtual bool match(Symbol const &val) const;
     virtual Sig getSig() const;
     virtual UTerm renameVars(RenameMap &names) const;
@@ -591,6 +600,11 @@ struct UnOpTerm : public Term {
 
     UnOp const op;
     UTerm arg;
+
+private:
+    friend Symbol evalArg(Term const &arg, bool &undefined, Logger &log);
+    // Evaluates the term without trying evalNum first (see eval).
+    Symbol evalSlow(bool &undefined, Logger &log) const;
 };
 
 // }}}
@@ -606,6 +620,7 @@ struct BinOpTerm : public Term {
     virtual void collect(VarTermBoundVec &vars, bool bound) const;
     virtual void collect(VarSet &vars, unsigned minLevel = 0, unsigned maxLevel = std::numeric_limits<unsigned>::max()) const;
     virtual Symbol eval(bool &undefined, Logger &log) const;
+    virtual bool evalNum(int &num) const;
     virtual bool match(Symbol const &val) const;
     virtual Sig getSig() const;
     virtual UTerm renameVars(RenameMap &names) const;
@@ -630,6 +645,11 @@ struct BinOpTerm : public Term {
     BinOp op;
     UTerm left;
     UTerm right;
+
+private:
+    friend Symbol evalArg(Term const &arg, bool &undefined, Logger &log);
+    // Evaluates the term without trying evalNum first (see eval).
+    Symbol evalSlow(bool &undefined, Logger &log) const;
 };
 
 // }}}
@@ -765,6 +785,7 @@ struct LinearTerm : Term {
     virtual void collect(VarTermBoundVec &vars, bool bound) const;
     virtual void collect(VarSet &vars, unsigned minLevel = 0, unsigned maxLevel = std::numeric_limits<unsigned>::max()) const;
     virtual Symbol eval(bool &undefined, Logger &log) const;
+    virtual bool evalNum(int &num) const;
     virtual bool match(Symbol const &val) const;
     virtual Sig getSig() const;
     virtual UTerm renameVars(RenameMap &names) const;
@@ -789,6 +810,11 @@ struct LinearTerm : Term {
     UVarTerm var;
     int m;
     int n;
+
+private:
+    friend Symbol evalArg(Term const &arg, bool &undefined, Logger &log);
+    // Evaluates the term without trying evalNum first (see eval).
+    Symbol evalSlow(bool &undefined, Logger &log) const;
 };
 
 // }}}
@@ -0,0 +1,237 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/decompress.hh"
+#include <stdexcept>
+#include <cstdio>
+#ifdef CLINGO_WITH_ZLIB
+#   include <zlib.h>
+#   include <cstring>
+#   include <vector>
+#   include <deque>
+#   include <thread>
+#   include <mutex>
+#   include <condition_variable>
+#   include <exception>
+#   include <system_error>
+#endif
+
+namespace Gringo {
+
+bool isCompressed(std::istream &in) {
+    // gzip files start with the bytes 0x1f 0x8b
+    auto *buf = in.rdbuf();
+    if (!buf || buf->sgetc() != 0x1f) { return false; }
+    buf->sbumpc();
+    bool ret = buf->sgetc() == 0x8b;
+    buf->sungetc();
+    return ret;
+}
+
+#ifdef CLINGO_WITH_ZLIB
+
+namespace {
+
+constexpr size_t bufSize = 1 << 16;
+
+// {{{1 definition of Inflater
+
+class Inflater {
+public:
+    Inflater(std::unique_ptr<std::istream> in)
+    : in_(std::move(in))
+    , buf_(bufSize) {
+        std::memset(&strm_, 0, sizeof(strm_));
+        // NOTE: adding 16 to the window bits selects the gzip format
+        if (inflateInit2(&strm_, 16 + MAX_WBITS) != Z_OK) {
+            throw std::runtime_error("could not initialize zlib");
+        }
+    }
+    Inflater(Inflater const &) = delete;
+    Inflater &operator=(Inflater const &) = delete;
+    ~Inflater() { inflateEnd(&strm_); }
+
+    // Decompresses up to size bytes into out and returns the number of bytes
+    // written; zero is only returned at the end of the input.
+    size_t read(char *out, size_t size) {
+        strm_.next_out = reinterpret_cast<Bytef*>(out);
+        strm_.avail_out = static_cast<uInt>(size);
+        while (strm_.avail_out > 0 && !done_) {
+            if (strm_.avail_in == 0) {
+                in_->read(buf_.data(), buf_.size());
+                strm_.next_in = reinterpret_cast<Bytef*>(buf_.data());
+                strm_.avail_in = static_cast<uInt>(in_->gcount());
+                if (strm_.avail_in == 0) {
+                    if (!end_) { throw std::runtime_error("unexpected end of compressed input"); }
+                    done_ = true;
+                    break;
+                }
+            }
+            switch (inflate(&strm_, Z_NO_FLUSH)) {
+                case Z_STREAM_END: {
+                    // another gzip member might follow
+                    end_ = true;
+                    inflateReset(&strm_);
+                    break;
+                }
+                case Z_OK: {
+                    end_ = false;
+                    break;
+                }
+                default: {
+                    throw std::runtime_error(strm_.msg ? strm_.msg : "corrupt compressed input");
+                }
+            }
+        }
+        return size - strm_.avail_out;
+    }
+
+private:
+    std::unique_ptr<std::istream> in_;
+    std::vector<char> buf_;
+    z_stream strm_;
+    bool end_ = false;
+    bool done_ = false;
+};
+
+// {{{1 definition of InflateBuf
+
+class InflateBuf : public std::streambuf {
+public:
+    InflateBuf(std::unique_ptr<std::istream> in, bool threaded)
+    : inflater_(std::move(in))
+    , buf_(bufSize) {
+        if (threaded) {
+            try { thread_ = std::thread([this]() { produce(); }); }
+            catch (std::system_error const &) { }
+        }
+    }
+    ~InflateBuf() override {
+        if (thread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            thread_.join();
+        }
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) { return traits_type::to_int_type(*gptr()); }
+        size_t n = thread_.joinable() ? consume() : inflater_.read(buf_.data(), buf_.size());
+        if (n == 0) { return traits_type::eof(); }
+        setg(buf_.data(), buf_.data(), buf_.data() + n);
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    static constexpr size_t maxQueue = 4;
+
+    // Runs on the decompression thread; an empty chunk marks the end.
+    void produce() {
+        std::vector<char> chunk;
+        std::exception_ptr error;
+        try {
+            do {
+                chunk.resize(bufSize);
+                chunk.resize(inflater_.read(chunk.data(), chunk.size()));
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return stop_ || queue_.size() < maxQueue; });
+                if (stop_) { return; }
+                bool last = chunk.empty();
+                queue_.emplace_back(std::move(chunk));
+                cv_.notify_all();
+                if (last) { return; }
+                chunk = std::vector<char>();
+            }
+            while (true);
+        }
+        catch (...) { error = std::current_exception(); }
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = error;
+        queue_.emplace_back();
+        cv_.notify_all();
+    }
+    // Takes the next chunk from the decompression thread.
+    size_t consume() {
+        if (finished_) { return 0; }
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !queue_.empty(); });
+        buf_.swap(queue_.front());
+        queue_.pop_front();
+        cv_.notify_all();
+        if (buf_.empty()) {
+            finished_ = true;
+            if (error_) { std::rethrow_exception(error_); }
+        }
+        return buf_.size();
+    }
+
+private:
+    Inflater inflater_;
+    std::vector<char> buf_;
+    std::deque<std::vector<char>> queue_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::exception_ptr error_;
+    bool stop_ = false;
+    bool finished_ = false;
+    std::thread thread_;
+};
+
+// {{{1 definition of InflateStream
+
+class InflateStream : public std::istream {
+public:
+    InflateStream(std::unique_ptr<std::istream> in, bool threaded)
+    : std::istream(nullptr)
+    , buf_(std::move(in), threaded) {
+        rdbuf(&buf_);
+        // errors during decompression are reported as exceptions
+        exceptions(std::ios::badbit);
+    }
+
+private:
+    InflateBuf buf_;
+};
+
+// }}}1
+
+} // namespace
+
+std::unique_ptr<std::istream> decompress(std::unique_ptr<std::istream> in, bool threaded) {
+    return std::unique_ptr<std::istream>(new InflateStream(std::move(in), threaded));
+}
+
+#else
+
+std::unique_ptr<std::istream> decompress(std::unique_ptr<std::istream>, bool) {
+    throw std::runtime_error("compressed input is not supported: gringo has been built without zlib");
+}
+
+#endif
+
+} // namespace Gringo
@@ -44,10 +44,18 @@ BackjumpBinder::BackjumpBinder(UIdx &&index, DependVec &&depends)
     : index(std::move(index))
     , depends(std::move(depends)) { }
 BackjumpBinder::BackjumpBinder(BackjumpBinder &&) noexcept = default;
-void BackjumpBinder::match(Logger &log) { index->match(log); }
-bool BackjumpBinder::next() { return index->next(); }
-bool BackjumpBinder::first(Logger &log) {
+void BackjumpBinder::match(Logger &log) {
+    for (auto &x : batch) { x->prefetch(log); }
+    if (explain) { ++matches; }
     index->match(log);
+}
+bool BackjumpBinder::next() {
+    bool ret = index->next();
+    if (explain) { bindings += ret; }
+    return ret;
+}
+bool BackjumpBinder::first(Logger &log) {
+    match(log);
     return next();
 }
 void BackjumpBinder::print(std::ostream &out) const {
@@ -68,28 +76,107 @@ void Instantiator::add(UIdx &&index, DependVec &&depends) {
 }
 void Instantiator::finalize(DependVec &&depends) {
     binders.emplace_back(gringo_make_unique<SolutionBinder>(), std::move(depends));
+    // Consecutive binders that do not bind variables are all matched under
+    // the same assignment. Their lookups are prefetched as a batch before
+    // the first one is matched to overlap the memory accesses.
+    for (auto it = binders.begin(), ie = binders.end(); it != ie; ) {
+        auto jt = std::find_if(it, ie, [](BackjumpBinder const &x) { return !x.index->prefetchable(); });
+        if (jt - it > 1) {
+            for (auto kt = it; kt != jt; ++kt) { it->batch.emplace_back(kt->index.get()); }
+        }
+        it = jt != ie ? jt + 1 : jt;
+    }
+}
+void Instantiator::memoizeFailures(bool recursive) {
+    failuresExpire = recursive;
+    // Memoizing only pays off if at least two binders follow the position.
+    // Whether the remaining body has a solution does not depend on the
+    // solution binder, which always succeeds.
+    for (size_t k = 1; k + 2 < binders.size(); ++k) {
+        auto &x = binders[k];
+        x.memoDepends.clear();
+        x.memoVars.clear();
+        for (auto jt = binders.begin() + k, je = binders.end() - 1; jt != je; ++jt) {
+            for (auto &d : jt->depends) {
+                if (d < k) { x.memoDepends.emplace_back(d); }
+            }
+            for (auto &var : jt->uses) {
+                auto bound = [&var](BackjumpBinder const &y) { return std::find(y.binds.begin(), y.binds.end(), var) != y.binds.end(); };
+                if (std::find(x.memoVars.begin(), x.memoVars.end(), var) == x.memoVars.end() && !std::any_of(binders.begin() + k, jt, bound)) {
+                    x.memoVars.emplace_back(var);
+                }
+            }
+        }
+        std::sort(x.memoDepends.begin(), x.memoDepends.end());
+        x.memoDepends.erase(std::unique(x.memoDepends.begin(), x.memoDepends.end()), x.memoDepends.end());
+        x.memoizable = true;
+    }
+}
+void Instantiator::setFailureKey(BackjumpBinder const &x, unsigned pos) {
+    failureKey.clear();
+    failureKey.emplace_back(Symbol::createNum(pos));
+    for (auto &var : x.memoVars) { failureKey.emplace_back(*var); }
+}
+bool Instantiator::failed(BackjumpBinder &x, unsigned pos) {
+    if (!x.memoize) { return false; }
+    setFailureKey(x, pos);
+    ++x.memoLookups;
+    auto it = failures.find(failureKey);
+    if (it != failures.end() && (!failuresExpire || it->second == solutions)) {
+        ++x.memoHits;
+        return true;
+    }
+    // stop memoizing at positions that are never entered twice with the same values
+    if (x.memoHits == 0 && x.memoLookups >= 1024) { x.memoize = false; }
+    return false;
+}
+void Instantiator::recordFailure(BackjumpBinder &x, unsigned pos) {
+    if (x.memoize && x.entered == solutions) {
+        if (failures.size() >= maxFailures) { failures.clear(); }
+        setFailureKey(x, pos);
+        failures[failureKey] = solutions;
+    }
 }
 void Instantiator::enqueue(Queue &queue) { queue.enqueue(*this); }
 void Instantiator::instantiate(Output::OutputBase &out, Logger &log) {
 #if DEBUG_INSTANTIATION > 0
     std::cerr << "  instantiate: " << *this << std::endl;
 #endif
+    for (auto &x : binders) {
+        x.memoize = x.memoizable;
+        x.memoLookups = x.memoHits = 0;
+        x.explain = explained;
+    }
+    solutions = 0;
     auto ie = binders.rend(), it = ie - 1, ib = binders.rbegin();
+    auto pos = [ie](decltype(it) jt) { return static_cast<unsigned>(ie - jt - 1); };
     it->match(log);
     do {
 #if DEBUG_INSTANTIATION > 1
         std::cerr << "    start at: " << *it << std::endl;
 #endif
         it->backjumpable = true;
+        bool memoized = false;
         if (it->next()) {
-            for (--it; it->first(log); --it) { it->backjumpable = true; }
+            for (--it; !(memoized = failed(*it, pos(it))); --it) {
+                it->entered = solutions;
+                if (!it->first(log)) { break; }
+                it->backjumpable = true;
+            }
 #if DEBUG_INSTANTIATION > 1
             std::cerr << "    advanced to: " << *it << std::endl;
 #endif
         }
-        if (it == ib) { callback->report(out, log); }
-        for (auto &x : it->depends) { binders[x].backjumpable = false; }
+        if (it == ib) {
+            callback->report(out, log);
+            ++solutions;
+        }
+        for (auto &x : memoized ? it->memoDepends : it->depends) { binders[x].backjumpable = false; }
+        auto jt = it;
+        if (memoized) { ++jt; }
         for (++it; it != ie && it->backjumpable; ++it) { }
+        // the binders jumped over have been exhausted under the current bindings
+        for (; jt != it; ++jt) { recordFailure(*jt, pos(jt)); }
 #if DEBUG_INSTANTIATION > 1
         std::cerr << "    backfumped to: ";
         if (it != ie) { it->print(std::cerr); }
@@ -98,6 +185,13 @@ void Instantiator::instantiate(Output::OutputBase &out, Logger &log) {
 #endif
     }
     while (it != ie);
+    FailureMap().swap(failures);
+    if (explained) {
+        for (auto &x : binders) {
+            x.memoLookupsTotal += x.memoLookups;
+            x.memoHitsTotal += x.memoHits;
+        }
+    }
 }
 void Instantiator::print(std::ostream &out) const {
     using namespace std::placeholders;
@@ -107,6 +201,19 @@ void Instantiator::print(std::ostream &out) const {
     print_comma(out, binders, " , ", std::bind(&BackjumpBinder::print, _2, _1));
     out << ".";
 }
+void Instantiator::explain(std::ostream &out) const {
+    out << "instantiator: ";
+    print(out);
+    out << "\n";
+    out << "pos\tkind\testimate\tmatches\tbindings\tmemo-lookups\tmemo-hits\tliteral\n";
+    // the last binder reports solutions and is matched once per solution
+    unsigned pos = 0;
+    for (auto it = binders.begin(), ie = binders.end() - 1; it != ie; ++it) {
+        out << ++pos << "\t" << it->index->kind() << "\t" << it->estimate << "\t" << it->matches << "\t" << it->bindings;
+        out << "\t" << it->memoLookupsTotal << "\t" << it->memoHitsTotal << "\t" << *it->index << "\n";
+    }
+    out << "solutions: " << binders.back().matches << "\n";
+}
 unsigned Instantiator::priority() const {
     return callback->priority();
 }
@@ -126,6 +233,10 @@ void Queue::process(Output::OutputBase &out, Logger &log) {
 #endif
                 queue.swap(current);
                 for (Instantiator &x : current) {
+                    if (explained && !x.explained) {
+                        x.explained = true;
+                        explained->emplace_back(x);
+                    }
                     x.instantiate(out, log);
                     x.enqueued = false;
                 }
@@ -49,7 +49,7 @@ struct RangeBinder : Binder {
         }
         else {
             if (!undefined) {
-                GRINGO_REPORT(log, Warnings::OperationUndefined)
+                GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, (range.first->loc() + range.second->loc()))
                     << (range.first->loc() + range.second->loc()) << ": info: interval undefined:\n"
                     << "  " << *range.first << ".." << *range.second << "\n";
             }
@@ -63,6 +63,7 @@ struct RangeBinder : Binder {
         return current <= end && assign->match(Symbol::createNum(current++));
     }
     void print(std::ostream &out) const override { out << *assign << "=" << *range.first << ".." << *range.second; }
+    char const *kind() const override { return "range"; }
     virtual ~RangeBinder() { }
 
     UTerm               assign;
@@ -88,7 +89,7 @@ struct RangeMatcher : Binder {
         }
         else {
             if (!undefined) {
-                GRINGO_REPORT(log, Warnings::OperationUndefined)
+                GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, (range.first->loc() + range.second->loc()))
                     << (range.first->loc() + range.second->loc()) << ": info: interval undefined:\n"
                     << "  " << *range.first << ".." << *range.second << "\n";
             }
@@ -137,6 +138,7 @@ struct ScriptBinder : Binder {
         print_comma(out, std::get<1>(shared), ",", [](std::ostream &out, UTerm const &term) { out << *term; });
         out << ")";
     }
+    char const *kind() const override { return "script"; }
     virtual ~ScriptBinder() { }
 
     Context             &context;
@@ -203,6 +205,7 @@ struct AssignBinder : Binder {
         return ret;
     }
     void print(std::ostream &out) const override { out << *lhs << "=" << rhs; }
+    char const *kind() const override { return "assign"; }
     UTerm lhs;
     Term &rhs;
     bool firstMatch = false;
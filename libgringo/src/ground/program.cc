@@ -73,24 +73,16 @@ void Program::linearize(Context &context, Logger &log) {
     linearized = true;
 }
 
-void Program::ground(Parameters const &params, Context &context, Output::OutputBase &out, Logger &log) {
+void Program::ground(Parameters const &params, Context &context, Output::OutputBase &out, Logger &log, std::ostream *explain) {
     for (auto &dom : out.predDoms()) {
         auto name = dom->sig().name();
         if (name.startsWith("#p_")) {
             // The idea here is to assign a fresh uid to each projection atom.
             // Furthermore, the fresh atom is derived by the old atom.
             // This prevents redefinition errors from projections.
-            for (auto &atom : *dom) {
-                if (!atom.fact() && atom.hasUid() && atom.defined()) {
-                    Output::Rule &rule = out.tempRule(false);;
-                    Atom_t oldUid = atom.uid();
-                    Atom_t newUid = out.data.newAtom();
-                    rule.addHead(Output::LiteralId{NAF::POS, Output::AtomType::Aux, newUid, dom->domainOffset()});
-                    rule.addBody(Output::LiteralId{NAF::POS, Output::AtomType::Aux, oldUid, dom->domainOffset()});
-                    out.output(rule);
-                    atom.resetUid(newUid);
-                }
-            }
+            // To keep the cost proportional to the atoms used in this step,
+            // this is done lazily when an atom is output the first time.
+            dom->renewUids(out.data.maxAtom());
         }
         else if (name.startsWith("#inc_")) {
             // clear incremental domains
@@ -124,6 +116,8 @@ void Program::ground(Parameters const &params, Context &context, Output::OutputB
     }
     for (auto &x : out.predDoms()) { x->nextGeneration(); }
     Queue q;
+    Queue::QueueDec explained;
+    if (explain) { q.explained = &explained; }
     for (auto &x : stms) {
         if (!linearized) {
             for (auto &y : x.first) { y->startLinearize(true); }
@@ -154,6 +148,10 @@ void Program::ground(Parameters const &params, Context &context, Output::OutputB
         }
     }
     out.endGround(log);
+    for (Instantiator &x : explained) {
+        x.explain(*explain);
+        x.explained = false;
+    }
     linearized = true;
 }
 
@@ -105,6 +105,7 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
         SC s;
         std::unordered_map<String, SC::VarNode*> varMap;
         std::vector<std::pair<String, std::vector<unsigned>>> boundBy;
+        SValVec refs;
         for (auto &lit : x) {
             auto &entNode(s.insertEnt(lit.first, *lit.second));
             VarTermBoundVec vars;
@@ -115,6 +116,7 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
                     if (!varNode)   {
                         varNode = &s.insertVar(numeric_cast<unsigned>(boundBy.size()));
                         boundBy.emplace_back(occ.first->name, std::vector<unsigned>{});
+                        refs.emplace_back(occ.first->ref);
                     }
                     if (occ.second) { s.insertEdge(entNode, *varNode); }
                     else            { s.insertEdge(*varNode, entNode); }
@@ -133,6 +135,7 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
             return sx < sy;
         };
 
+        Logger silent{[](Warnings, char const *) { }, 0};
         SC::EntVec open;
         s.init(open);
         while (!open.empty()) {
@@ -140,14 +143,19 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
                 if (pred((*it)->data, open.back()->data)) { std::swap(open.back(), *it); }
             }
             auto y = open.back();
+            SValVec binds, uses;
             for (auto &var : y->data.vars) {
                 auto &bb(boundBy[var]);
+                auto &vars = bound.find(bb.first) == bound.end() ? binds : uses;
+                if (std::find(vars.begin(), vars.end(), refs[var]) == vars.end()) { vars.emplace_back(refs[var]); }
                 if (bound.find(bb.first) == bound.end()) {
                     bb.second.emplace_back(uid);
                     if ((depend.empty() || depend.back() != uid) && important.find(bb.first) != important.end()) { depend.emplace_back(uid); }
                 }
                 else { y->data.depends.insert(y->data.depends.end(), bb.second.begin(), bb.second.end()); }
             }
+            // the estimate is only recorded to explain the plan (warnings are reported when matching)
+            double estimate = y->data.lit.score(bound, silent);
             auto index(y->data.lit.index(context, y->data.type, bound));
             if (auto update = index->getUpdater()) {
                 if (BodyOcc *occ = y->data.lit.occurrence()) {
@@ -157,11 +165,15 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
             std::sort(y->data.depends.begin(), y->data.depends.end());
             y->data.depends.erase(std::unique(y->data.depends.begin(), y->data.depends.end()), y->data.depends.end());
             insts.back().add(std::move(index), std::move(y->data.depends));
+            insts.back().binders.back().estimate = estimate;
+            insts.back().binders.back().binds = std::move(binds);
+            insts.back().binders.back().uses = std::move(uses);
             uid++;
             open.pop_back();
             s.propagate(y, open);
         }
         insts.back().finalize(std::move(depend));
+        insts.back().memoizeFailures(std::any_of(x.begin(), x.end(), [](std::pair<BinderType,Literal*> const &lit) { return lit.second->isRecursive(); }));
     }
     return insts;
 }
@@ -186,6 +198,7 @@ struct BindOnce : Binder, IndexUpdater {
         return ret;
     }
     void print(std::ostream &out) const override { out << "#once"; }
+    char const *kind() const override { return "once"; }
     bool once;
 };
 
@@ -410,7 +423,10 @@ void Rule::report(Output::OutputBase &out, Logger &log) {
         if (!choice && fact && rule.numHeads() == 1) {
             Output::LiteralId head = rule.heads().front();
             auto &dom = *out.predDoms()[head.domain()];
-            dom[head.offset()].setFact(true);
+            auto &atom = dom[head.offset()];
+            // the uid of an earlier step must not be reused for the fact
+            if (atom.hasUid() && dom.needsRenewal(atom)) { out.data.renewUid(atom, head.domain()); }
+            atom.setFact(true);
         }
         if (origin != NULL) {
             origin->stats.incrementCounters(rule.body().size());
@@ -496,7 +512,7 @@ void ShowStatement::report(Output::OutputBase &out, Logger &log) {
         out.output(ss);
     }
     else {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, term_->loc())
             << term_->loc() << ": info: tuple ignored:\n"
             << "  " << term << "\n";
     }
@@ -530,13 +546,13 @@ void EdgeStatement::report(Output::OutputBase &out, Logger &log) {
     bool undefined = false;
     Symbol u = u_->eval(undefined, log);
     if (undefined) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, u_->loc())
             << u_->loc() << ": info: edge ignored\n";
         return;
     }
     Symbol v = v_->eval(undefined, log);
     if (undefined) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, v_->loc())
             << v_->loc() << ": info: edge ignored\n";
         return;
     }
@@ -623,14 +639,14 @@ void HeuristicStatement::report(Output::OutputBase &out, Logger &log) {
     // check value
     Symbol value = value_->eval(undefined, log);
     if (undefined || value.type() != SymbolType::Num) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, value_->loc())
             << value_->loc() << ": info: heuristic directive ignored\n";
         return;
     }
     // check priority
     Symbol priority = priority_->eval(undefined, log);
     if (undefined || priority.type() != SymbolType::Num || priority.num() < 0) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, priority_->loc())
             << priority_->loc() << ": info: heuristic directive ignored\n";
         return;
     }
@@ -645,7 +661,7 @@ void HeuristicStatement::report(Output::OutputBase &out, Logger &log) {
     else if (mod == Symbol::createId("init"))   { heuMod = Potassco::Heuristic_t::Init; }
     else if (mod == Symbol::createId("sign"))   { heuMod = Potassco::Heuristic_t::Sign; }
     else {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, mod_->loc())
             << mod_->loc() << ": info: heuristic directive ignored\n";
         return;
     }
@@ -705,7 +721,7 @@ void WeakConstraint::report(Output::OutputBase &out, Logger &log) {
         out.output(min);
     }
     else if (!undefined) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, tuple_.front()->loc())
             << tuple_.front()->loc() << ": info: tuple ignored:\n"
             << "  " << out.tempVals_.front() << "@" << out.tempVals_[1] << "\n";
     }
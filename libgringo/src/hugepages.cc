@@ -0,0 +1,80 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/hugepages.hh"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#if defined(__linux__)
+#   include <sys/mman.h>
+#endif
+
+namespace Gringo {
+
+namespace {
+
+std::atomic<bool> &hugePagesFlag() {
+    static std::atomic<bool> flag{[]() {
+        char const *env = std::getenv("GRINGO_HUGE_PAGES");
+        return env && std::strcmp(env, "0") != 0 && *env != '\0';
+    }()};
+    return flag;
+}
+
+} // namespace
+
+bool hugePages() {
+    return hugePagesFlag().load(std::memory_order_relaxed);
+}
+
+void setHugePages(bool enable) {
+    hugePagesFlag().store(enable, std::memory_order_relaxed);
+}
+
+// NOTE: both branches allocate with the malloc family so that freeHuge does
+// not have to know which one was taken; the policy may change in between
+void *allocHuge(size_t size) {
+    void *ret = nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (size >= hugePageSize && hugePages()) {
+        // round up to whole huge pages so that the last page can be backed too
+        size_t rounded = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+        if (rounded >= size && posix_memalign(&ret, hugePageSize, rounded) == 0) {
+            // failure is not fatal, the kernel falls back to normal pages
+            madvise(ret, rounded, MADV_HUGEPAGE);
+            return ret;
+        }
+        ret = nullptr;
+    }
+#endif
+    ret = std::malloc(size > 0 ? size : 1);
+    if (!ret) { throw std::bad_alloc(); }
+    return ret;
+}
+
+void freeHuge(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+} // namespace Gringo
@@ -28,8 +28,31 @@
 
 namespace Gringo { namespace Input {
 
+namespace {
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool isIdentifierChar(char c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_' || c == '\'';
+}
+
+void skipSpace(char const *&it) {
+    while (isSpace(*it)) { ++it; }
+}
+
+} // namespace
+
 GroundTermParser::GroundTermParser() { }
+
 Symbol GroundTermParser::parse(std::string const &str, Logger &log) {
+    return parse(str.c_str(), log);
+}
+
+Symbol GroundTermParser::parse(char const *str, Logger &log) {
+    Symbol ret;
+    if (parseSimple(str, ret)) { return ret; }
     log_ = &log;
     undefined_ = false;
     while (!empty()) { pop(); }
@@ -39,6 +62,107 @@ Symbol GroundTermParser::parse(std::string const &str, Logger &log) {
     return undefined_ ? Symbol() : value;
 }
 
+bool GroundTermParser::parseAtom(char const *&it, Symbol &ret) {
+    bool sign = false;
+    if (*it == '-') {
+        sign = true;
+        ++it;
+    }
+    if ('0' <= *it && *it <= '9') {
+        // NOTE: larger numbers and numbers in other bases are left to the lexer
+        char const *start = it;
+        int num = 0;
+        for (; '0' <= *it && *it <= '9'; ++it) {
+            // NOTE: nine digits always fit into an int
+            if (it - start == 9) { return false; }
+            num = num * 10 + (*it - '0');
+        }
+        if (*start == '0' && it - start > 1) { return false; }
+        ret = Symbol::createNum(sign ? -num : num);
+        return true;
+    }
+    char const *start = it;
+    while (*it == '_' || *it == '\'') { ++it; }
+    if ('a' <= *it && *it <= 'z') {
+        while (isIdentifierChar(*it)) { ++it; }
+        ret = Symbol::createId(String({start, static_cast<size_t>(it - start)}), sign);
+        return true;
+    }
+    if (*it == '"' && it == start && !sign) {
+        bool escaped = false;
+        for (++it; *it != '"'; ++it) {
+            if (*it == '\0' || *it == '\n') { return false; }
+            if (*it == '\\') {
+                ++it;
+                if (*it != 'n' && *it != '\\' && *it != '"') { return false; }
+                escaped = true;
+            }
+        }
+        StringSpan str{start + 1, static_cast<size_t>(it - start - 1)};
+        ++it;
+        ret = escaped ? Symbol::createStr(unquote(str).c_str()) : Symbol::createStr(str);
+        return true;
+    }
+    return false;
+}
+
+bool GroundTermParser::parseSimple(char const *str, Symbol &ret) {
+    char const *it = str;
+    skipSpace(it);
+    String name("");
+    bool sign = false;
+    if (*it != '(') {
+        if (!parseAtom(it, ret)) { return false; }
+        skipSpace(it);
+        if (*it != '(') { return *it == '\0'; }
+        if (ret.type() != SymbolType::Fun) { return false; }
+        name = ret.name();
+        sign = ret.sign();
+    }
+    ++it;
+    skipSpace(it);
+    args_.clear();
+    bool forceTuple = false;
+    if (*it != ')') {
+        for (;;) {
+            if (*it == ',' && args_.empty() && name.empty()) {
+                // the empty tuple written as (,)
+                ++it;
+                skipSpace(it);
+                if (*it != ')') { return false; }
+                break;
+            }
+            Symbol arg;
+            if (!parseAtom(it, arg)) { return false; }
+            args_.emplace_back(arg);
+            skipSpace(it);
+            if (*it == ')') { break; }
+            if (*it != ',') { return false; }
+            ++it;
+            skipSpace(it);
+            if (*it == ')') {
+                // a trailing comma is only permitted in tuples
+                if (!name.empty()) { return false; }
+                forceTuple = true;
+                break;
+            }
+        }
+    }
+    ++it;
+    skipSpace(it);
+    if (*it != '\0') { return false; }
+    if (!name.empty()) {
+        ret = Symbol::createFun(name, Potassco::toSpan(args_), sign);
+    }
+    else if (!forceTuple && args_.size() == 1) {
+        ret = args_.front();
+    }
+    else {
+        ret = Symbol::createTuple(Potassco::toSpan(args_));
+    }
+    return true;
+}
+
 Symbol GroundTermParser::term(BinOp op, Symbol a, Symbol b) {
     if (a.type() == SymbolType::Num && b.type() == SymbolType::Num && (op != BinOp::DIV || b.num() != 0)) {
         return Symbol::createNum(Gringo::eval(op, a.num(), b.num()));
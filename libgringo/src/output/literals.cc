@@ -82,6 +82,62 @@ void makeFalse(DomainData &data, Translator &trans, NAF naf, Atom &atm) {
     else { atm.setLit(atomlit); }
 }
 
+// Adds the constraints ensuring that the bounds of a cardinality-bounded
+// choice hold if lit is true. Returns false if the aggregate does not
+// qualify; in this case, nothing is added and the generic aggregate
+// translation has to be used.
+//
+// A head aggregate qualifies if it is a count aggregate with exactly one
+// (possibly unbounded) interval as bound and each non-fact tuple is
+// associated with exactly one element. Then the bounds can be checked by
+// (at most two) weight rules over the element literals instead of
+// introducing an auxiliary body aggregate:
+//   :- b, not l { e_1; ...; e_n }.
+//   :- b, u+1 { e_1; ...; e_n }.
+// If the lower bound is n or the upper bound is 0, plain rules are used.
+bool translateCardinality(DomainData &data, Translator &x, LiteralId const &lit, AggregateFunction fun, DisjunctiveBounds const &bounds, Interval const &range, BodyAggregateElements const &bdElems) {
+    if (fun != AggregateFunction::COUNT || bounds.size() != 1) { return false; }
+    auto rng = DisjunctiveBounds(range).intersect(bounds);
+    if (rng.size() != 1 || rng.front().left.bound.type() != SymbolType::Num || rng.front().right.bound.type() != SymbolType::Num) { return false; }
+    // NOTE: fact tuples are already accounted for in the range
+    std::vector<ClauseId> clauses;
+    for (auto &elem : bdElems) {
+        bool fact = std::any_of(elem.second.begin(), elem.second.end(), [](ClauseId const &clause) { return clause.second == 0; });
+        if (fact) { continue; }
+        if (elem.second.size() != 1) { return false; }
+        clauses.emplace_back(elem.second.front());
+    }
+    int facts = range.left.bound.num();
+    int lower = rng.front().left.bound.num() + !rng.front().left.inclusive - facts;
+    int upper = rng.front().right.bound.num() - !rng.front().right.inclusive - facts;
+    int size  = static_cast<int>(clauses.size());
+    LitUintVec elems;
+    for (auto &clause : clauses) { elems.emplace_back(getEqualClause(data, x, clause, true, false), 1); }
+    if (lower == size) {
+        // :- b, not e_i.
+        for (auto &elem : elems) { Rule().addBody(lit).addBody(elem.first.negate()).translate(data, x); }
+    }
+    else if (lower > 0) {
+        // a :- l { e_1; ...; e_n }.
+        // :- b, not a.
+        LiteralId aux = data.newAux();
+        WeightRule(aux, lower, LitUintVec(elems)).translate(data, x);
+        Rule().addBody(lit).addBody(aux.negate()).translate(data, x);
+    }
+    if (upper == 0) {
+        // :- b, e_i.
+        for (auto &elem : elems) { Rule().addBody(lit).addBody(elem.first).translate(data, x); }
+    }
+    else if (upper < size) {
+        // a :- u+1 { e_1; ...; e_n }.
+        // :- b, a.
+        LiteralId aux = data.newAux();
+        WeightRule(aux, upper + 1, std::move(elems)).translate(data, x);
+        Rule().addBody(lit).addBody(aux).translate(data, x);
+    }
+    return true;
+}
+
 } // namespace
 
 int clamp(int64_t x) {
@@ -94,7 +150,7 @@ bool defined(SymVec const &tuple, AggregateFunction fun, Location const &loc, Lo
     if (tuple.empty()) {
         if (fun == AggregateFunction::COUNT) { return true; }
         else {
-            GRINGO_REPORT(log, Warnings::OperationUndefined)
+            GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc)
                 << loc << ": info: empty tuple ignored\n";
             return false;
         }
@@ -110,7 +166,7 @@ bool defined(SymVec const &tuple, AggregateFunction fun, Location const &loc, Lo
             else {
                 std::ostringstream s;
                 print_comma(s, tuple, ",");
-                GRINGO_REPORT(log, Warnings::OperationUndefined)
+                GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc)
                     << loc << ": info: tuple ignored:\n"
                     << "  " << s.str() << "\n";
                 return false;
@@ -125,7 +181,7 @@ bool neutral(SymVec const &tuple, AggregateFunction fun, Location const &loc, Lo
     if (tuple.empty()) {
         if (fun == AggregateFunction::COUNT) { return false; }
         else {
-            GRINGO_REPORT(log, Warnings::OperationUndefined)
+            GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc)
                 << loc << ": info: empty tuple ignored\n";
             return true;
         }
@@ -142,7 +198,7 @@ bool neutral(SymVec const &tuple, AggregateFunction fun, Location const &loc, Lo
         if (ret && tuple.front() != Symbol::createNum(0)) {
             std::ostringstream s;
             print_comma(s, tuple, ",");
-            GRINGO_REPORT(log, Warnings::OperationUndefined)
+            GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc)
                 << loc << ": info: tuple ignored:\n"
                 << "  " << s.str() << "\n";
         }
@@ -921,7 +977,9 @@ std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapp
     //for (auto &atom : atoms_) {
     //    std::cerr << "  " << static_cast<Symbol>(atom) << "=" << (atoms_.find(static_cast<Symbol>(atom)) != atoms_.end()) << "/" << atom.generation() << "/" << atom.defined() << "/" << atom.delayed() << std::endl;
     //}
+    rebuildFilter();
     delayed_.clear();
+    ++epoch_;
     generation_ = 1;
     initOffset_ = atoms_.size();
     initDelayedOffset_ = 0;
@@ -1009,8 +1067,10 @@ LiteralId PredicateLiteral::translate(Translator &trans) {
 }
 
 int PredicateLiteral::uid() const {
-    auto &atom = data_.predDoms()[id_.domain()]->operator[](id_.offset());
+    auto &domain = *data_.predDoms()[id_.domain()];
+    auto &atom = domain[id_.offset()];
     if (!atom.hasUid()) { atom.setUid(data_.newAtom()); }
+    else if (domain.needsRenewal(atom)) { data_.renewUid(atom, id_.domain()); }
     switch (id_.sign()) {
         case NAF::POS:    { return +static_cast<Potassco::Lit_t>(atom.uid()); }
         case NAF::NOT:    { return -static_cast<Potassco::Lit_t>(atom.uid()); }
@@ -1749,7 +1809,7 @@ LiteralId HeadAggregateLiteral::translate(Translator &x) {
             }
         }
         // :- b, not aggr.
-        if (!atm.bounds().contains(range)) {
+        if (!atm.bounds().contains(range) && !translateCardinality(data_, x, atm.lit(), atm.fun(), atm.bounds(), range, bdElems)) {
             LiteralId aggr = getEqualAggregate(data_, x, atm.fun(), NAF::NOT, atm.bounds(), range, bdElems, false);
             Rule check;
             check.addBody(atm.lit());
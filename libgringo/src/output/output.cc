@@ -56,6 +56,9 @@ public:
         call(data, lit_, &Literal::translate, trans);
     }
     void replaceDelayed(DomainData &, LitVec &) override { }
+    void count(DomainData &data, StatementCounter &counter) const override {
+        counter.literal(data, lit_);
+    }
     virtual ~DelayedStatement() noexcept = default;
 private:
     LiteralId lit_;
@@ -86,6 +89,31 @@ void translateLambda(DomainData &data, AbstractOutput &out, T const &lambda) {
     TranslateStatement<T>(lambda).passTo(data, out);
 }
 
+// {{{2 definition of CountStatement
+
+template <class T>
+class CountStatement : public Statement {
+public:
+    CountStatement(T const &lambda)
+    : lambda_(lambda)
+    { }
+    void output(DomainData &, UBackend &) const override { }
+    void print(PrintPlain, char const *) const override { }
+    void translate(DomainData &, Translator &) override { }
+    void replaceDelayed(DomainData &, LitVec &) override { }
+    void count(DomainData &data, StatementCounter &counter) const override {
+        lambda_(data, counter);
+    }
+    virtual ~CountStatement() { }
+private:
+    T const &lambda_;
+};
+
+template <class T>
+void countLambda(DomainData &data, AbstractOutput &out, T const &lambda) {
+    CountStatement<T>(lambda).passTo(data, out);
+}
+
 // {{{2 definition of EndGroundStatement
 
 class EndGroundStatement : public Statement {
@@ -146,6 +174,15 @@ void BackendOutput::output(DomainData &data, Statement &stm) {
     stm.output(data, out_);
 }
 
+// {{{1 definition of CountOutput
+
+CountOutput::CountOutput(std::ostream &stream)
+: counter_(stream) { }
+
+void CountOutput::output(DomainData &data, Statement &stm) {
+    stm.count(data, counter_);
+}
+
 // {{{1 definition of OutputBase
 
 OutputBase::OutputBase(Potassco::TheoryData &data, OutputPredicates &&outPreds, std::ostream &out, OutputFormat format, OutputOptions opts)
@@ -229,6 +266,9 @@ UAbstractOutput OutputBase::fromFormat(std::ostream &stream, OutputFormat format
         }
         return out;
     }
+    else if (format == OutputFormat::COUNT) {
+        return gringo_make_unique<CountOutput>(stream);
+    }
     else {
         UBackend backend;
         switch (format) {
@@ -244,7 +284,8 @@ UAbstractOutput OutputBase::fromFormat(std::ostream &stream, OutputFormat format
                 backend = gringo_make_unique<BackendAdapter<SmodelsFormatBackend>>(stream);
                 break;
             }
-            case OutputFormat::TEXT: {
+            case OutputFormat::TEXT:
+            case OutputFormat::COUNT: {
                 throw std::logic_error("cannot happen");
             }
         }
@@ -272,6 +313,20 @@ void OutputBase::init(bool incremental) {
 void OutputBase::output(Statement &x) {
     x.replaceDelayed(data, delayed_);
     out_->output(data, x);
+    outputRenewed();
+}
+
+void OutputBase::outputRenewed() {
+    if (!data.renewed().empty()) {
+        std::vector<std::pair<LiteralId, LiteralId>> renewed;
+        renewed.swap(data.renewed());
+        for (auto &x : renewed) {
+            Rule &rule = tempRule(false);
+            rule.addHead(x.first);
+            rule.addBody(x.second);
+            out_->output(data, rule);
+        }
+    }
 }
 
 void OutputBase::beginStep() {
@@ -297,6 +352,7 @@ void OutputBase::endGround(Logger &log) {
         outPredsForce.clear();
     }
     EndGroundStatement(outPreds, log).passTo(data, *out_);
+    outputRenewed();
     // TODO: get rid of such things #d domains should be stored somewhere else
     std::set<Sig> rm;
     for (auto &x : predDoms()) {
@@ -316,6 +372,7 @@ void OutputBase::endStep(Assumptions const &ass) {
         if (auto b = backend_()) { b->assume(ass); }
     }
     backendLambda(data, *out_, [](DomainData &, UBackend &out) { out->endStep(); });
+    countLambda(data, *out_, [](DomainData &data, StatementCounter &x) { x.endStep(data); });
 }
 
 void OutputBase::reset(bool resetData) {
@@ -55,5 +55,103 @@ void translate(DomainData &data, Translator &x, LitVec &lits) {
     }
 }
 
+// {{{1 definition of StatementCounter
+
+void StatementCounter::rule(DomainData &data, LitVec const &head, LitVec const &body) {
+    ++rules;
+    bytes += 2 * sizeof(uint32_t);
+    for (auto &lit : head) { literal(data, lit); }
+    for (auto &lit : body) { literal(data, lit); }
+}
+
+void StatementCounter::statement(DomainData &data, LitVec const &body, unsigned size) {
+    ++statements;
+    bytes += 2 * sizeof(uint32_t) + size;
+    for (auto &lit : body) { literal(data, lit); }
+}
+
+void StatementCounter::statement(DomainData &data, LiteralId lit, LitVec const &body, unsigned size) {
+    literal(data, lit);
+    statement(data, body, size);
+}
+
+void StatementCounter::literal(DomainData &data, LiteralId lit) {
+    ++literals;
+    bytes += sizeof(Potassco::Lit_t);
+    if (lit.type() == AtomType::Predicate || lit.type() == AtomType::Aux) { return; }
+    // elements are shared among all occurrences of an atom
+    if (!seen_.emplace(lit.withSign(NAF::POS).repr()).second) { return; }
+    uint64_t n = 0;
+    switch (lit.type()) {
+        case AtomType::BodyAggregate: {
+            n = data.getAtom<BodyAggregateDomain>(lit.domain(), lit.offset()).numElems();
+            break;
+        }
+        case AtomType::AssignmentAggregate: {
+            auto &dom = data.getDom<AssignmentAggregateDomain>(lit.domain());
+            n = dom.data(dom[lit.offset()].data()).elems().size();
+            break;
+        }
+        case AtomType::HeadAggregate: {
+            n = data.getAtom<HeadAggregateDomain>(lit.domain(), lit.offset()).elems().size();
+            break;
+        }
+        case AtomType::Disjunction: {
+            n = data.getAtom<DisjunctionDomain>(lit.domain(), lit.offset()).elems().size();
+            break;
+        }
+        case AtomType::Conjunction: {
+            n = data.getAtom<ConjunctionDomain>(lit.domain(), lit.offset()).elems().size();
+            break;
+        }
+        case AtomType::Disjoint: {
+            n = data.getAtom<DisjointDomain>(lit.domain(), lit.offset()).elems().size();
+            break;
+        }
+        case AtomType::Theory: {
+            n = data.getAtom<TheoryDomain>(lit.domain(), lit.offset()).elems().size();
+            break;
+        }
+        case AtomType::LinearConstraint:
+        case AtomType::Predicate:
+        case AtomType::Aux: {
+            break;
+        }
+    }
+    elements += n;
+    bytes += n * sizeof(Potassco::WeightLit_t);
+}
+
+void StatementCounter::endStep(DomainData &data) {
+    uint64_t atoms = 0, facts = 0;
+    auto filter = data.filterStats();
+    // the domains have been recreated
+    if (filter.lookups < filter_.lookups) { filter_ = FilterStats(); }
+    for (auto &dom : data.predDoms()) {
+        if (dom->sig().name().startsWith("#")) { continue; }
+        for (auto &atom : *dom) {
+            if (atom.defined()) {
+                ++atoms;
+                if (atom.fact()) { ++facts; }
+            }
+        }
+    }
+    out_ << "rules      : " << rules << "\n"
+         << "statements : " << statements << "\n"
+         << "literals   : " << literals << "\n"
+         << "elements   : " << elements << "\n"
+         << "atoms      : " << atoms << "\n"
+         << "facts      : " << facts << "\n"
+         << "bytes      : " << bytes + atoms * sizeof(PredicateAtom) << "\n"
+         << "lookups    : " << filter.lookups - filter_.lookups << "\n"
+         << "filtered   : " << filter.rejected - filter_.rejected << "\n"
+         << "missed     : " << filter.misses - filter_.misses << "\n";
+    filter_ = filter;
+    rules = statements = literals = elements = bytes = 0;
+    seen_.clear();
+}
+
+// }}}1
+
 } } // namespace Output Gringo
 
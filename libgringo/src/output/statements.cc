@@ -144,6 +144,10 @@ void Rule::print(PrintPlain out, char const *prefix) const {
     out << ".\n";
 }
 
+void Rule::count(DomainData &data, StatementCounter &counter) const {
+    counter.rule(data, head_, body_);
+}
+
 void Rule::translate(DomainData &data, Translator &x) {
     head_.erase(std::remove_if(head_.begin(), head_.end(), [&](LiteralId &lit) {
         if (!call(data, lit, &Literal::isHeadAtom)) {
@@ -194,6 +198,10 @@ void External::print(PrintPlain out, char const *prefix) const {
     }
 }
 
+void External::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, head_, {});
+}
+
 void External::translate(DomainData &data, Translator &x) {
     x.output(data, *this);
 }
@@ -225,6 +233,10 @@ void ShowStatement::print(PrintPlain out, char const *prefix) const {
     out << ".\n";
 }
 
+void ShowStatement::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, body_, sizeof(Symbol));
+}
+
 void ShowStatement::replaceDelayed(DomainData &data, LitVec &delayed) {
     Gringo::Output::replaceDelayed(data, body_, delayed);
 }
@@ -252,6 +264,10 @@ void ProjectStatement::print(PrintPlain out, char const *prefix) const {
     out << ".\n";
 }
 
+void ProjectStatement::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, atom_, {});
+}
+
 void ProjectStatement::translate(DomainData &data, Translator &x) {
     x.output(data, *this);
 }
@@ -285,6 +301,10 @@ void HeuristicStatement::print(PrintPlain out, char const *prefix) const {
     out << ".[" << value_ << "@" << priority_ << "," << toString(mod_) << "]\n";
 }
 
+void HeuristicStatement::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, atom_, body_, 3 * sizeof(int));
+}
+
 void HeuristicStatement::translate(DomainData &data, Translator &x) {
     Gringo::Output::translate(data, x, body_);
     x.output(data, *this);
@@ -321,6 +341,10 @@ void EdgeStatement::print(PrintPlain out, char const *prefix) const {
     out << ".\n";
 }
 
+void EdgeStatement::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, body_, 2 * sizeof(int));
+}
+
 void EdgeStatement::translate(DomainData &data, Translator &x) {
     Gringo::Output::translate(data, x, body_);
     uidU_ = x.nodeUid(u_);
@@ -351,6 +375,10 @@ void TheoryDirective::print(PrintPlain out, char const *prefix) const {
     out << ".\n";
 }
 
+void TheoryDirective::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, theoryLit_, {});
+}
+
 void TheoryDirective::translate(DomainData &data, Translator &x) {
     x.output(data, *this);
     assert(!data.getAtom<TheoryDomain>(theoryLit_).recursive() && data.getAtom<TheoryDomain>(theoryLit_).type() == TheoryAtomType::Directive);
@@ -368,7 +396,7 @@ void TheoryDirective::replaceDelayed(DomainData &, LitVec &) {
 
 void WeakConstraint::translate(DomainData &data, Translator &x) {
     for (auto &z : lits_) { z = call(data, z, &Literal::translate, x); }
-    x.addMinimize(data.tuple(tuple_), getEqualClause(data, x, data.clause(std::move(lits_)), true, false));
+    x.addMinimize(tuple_[1].num(), data.tuple(tuple_), getEqualClause(data, x, data.clause(std::move(lits_)), true, false));
 }
 
 void WeakConstraint::print(PrintPlain out, char const *prefix) const {
@@ -383,6 +411,10 @@ void WeakConstraint::print(PrintPlain out, char const *prefix) const {
     out << "]\n";
 }
 
+void WeakConstraint::count(DomainData &data, StatementCounter &counter) const {
+    counter.statement(data, lits_, numeric_cast<unsigned>(tuple_.size() * sizeof(Symbol)));
+}
+
 void WeakConstraint::output(DomainData &, UBackend &) const {
     throw std::logic_error("WeakConstraint::output: must not be called");
 }
@@ -534,8 +566,8 @@ void Translator::addDisjointConstraint(DomainData &data, LiteralId lit) {
     }
     disjointCons_.emplace_back(lit);
 }
-void Translator::addMinimize(TupleId tuple, LiteralId cond) {
-    minimize_.emplace_back(tuple, cond);
+void Translator::addMinimize(int priority, TupleId tuple, LiteralId cond) {
+    minimize_[priority].emplace_back(tuple, cond);
 }
 void Translator::translate(DomainData &data, OutputPredicates const &outPreds, Logger &log) {
     for (auto &x : boundMap_) {
@@ -686,10 +718,12 @@ void Translator::atoms(DomainData &data, unsigned atomset, IsTrueLookup isTrue,
 }
 
 void Translator::simplify(DomainData &data, Mappings &mappings, AssignmentLookup assignment) {
-    minimize_.erase(std::remove_if(minimize_.begin(), minimize_.end(), [&](MinimizeList::value_type &elem) {
-        elem.second = call(data, elem.second, &Literal::simplify, mappings, assignment);
-        return elem.second != data.getTrueLit().negate();
-    }), minimize_.end());
+    for (auto &x : minimize_) {
+        x.second.erase(std::remove_if(x.second.begin(), x.second.end(), [&](MinimizeList::value_type &elem) {
+            elem.second = call(data, elem.second, &Literal::simplify, mappings, assignment);
+            return elem.second != data.getTrueLit().negate();
+        }), x.second.end());
+    }
     tuples_.erase([&](TupleLitMap::ValueType &elem) {
         elem.second = call(data, elem.second, &Literal::simplify, mappings, assignment);
         return elem.second != data.getTrueLit().negate();
@@ -769,15 +803,14 @@ void Translator::showValue(DomainData &data, Bound const &bound, LitVec const &c
 }
 
 void Translator::translateMinimize(DomainData &data) {
-    sort_unique(minimize_, [&data](TupleLit const &a, TupleLit const &b) {
-        auto aa = data.tuple(a.first), ab = data.tuple(b.first);
-        if (aa[1] != ab[1]) { return aa[1] < ab[1]; }
-        return a < b;
-    });
-    for (auto it = minimize_.begin(), iE = minimize_.end(); it != iE;) {
-        int priority = data.tuple(it->first)[1].num();
-        Minimize lm(priority);
-        do {
+    // Note: the elements are grouped by priority when added;
+    //       so only the elements of the current step have to be sorted here
+    for (auto &x : minimize_) {
+        auto &elems = x.second;
+        if (elems.empty()) { continue; }
+        sort_unique(elems);
+        Minimize lm(x.first);
+        for (auto it = elems.begin(), iE = elems.end(); it != iE;) {
             LitVec condLits;
             auto tuple = it->first;
             do {
@@ -795,7 +828,6 @@ void Translator::translateMinimize(DomainData &data) {
             ret.first->second = lit;
             lm.add(lit, weight);
         }
-        while (it != iE && data.tuple(it->first)[1].num() == priority);
         out_->output(data, lm);
     }
     minimize_.clear();
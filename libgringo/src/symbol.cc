@@ -482,6 +482,63 @@ void Symbol::print(std::ostream& out) const {
     }
 }
 
+void Symbol::print(std::string &out) const {
+    switch(symbolType_(rep_)) {
+        case SymbolType_::Num: {
+            char buf[16];
+            char *it = buf + sizeof(buf);
+            int n = num();
+            // NOTE: negating in unsigned arithmetic also works for the smallest integer
+            unsigned u = n < 0 ? 0u - static_cast<unsigned>(n) : static_cast<unsigned>(n);
+            do {
+                *--it = static_cast<char>('0' + u % 10);
+                u /= 10;
+            }
+            while (u > 0);
+            if (n < 0) { *--it = '-'; }
+            out.append(it, buf + sizeof(buf));
+            break;
+        }
+        case SymbolType_::IdN: { out.push_back('-'); }
+        case SymbolType_::IdP: {
+            char const *n = name().c_str();
+            out.append(n[0] != '\0' ? n : "()"); break;
+        }
+        case SymbolType_::Str: {
+            out.push_back('"');
+            for (char const *c = string().c_str(); *c != '\0'; ++c) {
+                switch (*c) {
+                    case '\n': { out.append("\\n"); break; }
+                    case '\\': { out.append("\\\\"); break; }
+                    case '"':  { out.append("\\\""); break; }
+                    default:   { out.push_back(*c); break; }
+                }
+            }
+            out.push_back('"');
+            break;
+        }
+        case SymbolType_::Inf: { out.append("#inf"); break; }
+        case SymbolType_::Sup: { out.append("#sup"); break; }
+        case SymbolType_::Fun: {
+            auto s = sig();
+            if (s.sign()) { out.push_back('-'); }
+            out.append(s.name().c_str());
+            auto a = args();
+            out.push_back('(');
+            for (auto it = begin(a), ie = end(a); it != ie; ++it) {
+                if (it != begin(a)) { out.push_back(','); }
+                it->print(out);
+            }
+            if (a.size == 1 && s.name() == "") {
+                out.push_back(',');
+            }
+            out.push_back(')');
+            break;
+        }
+        case SymbolType_::Special: { out.append("#special"); break; }
+    }
+}
+
 // }}}2
 
 // }}}1
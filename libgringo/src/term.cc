@@ -453,6 +453,11 @@ inline int ipow(int a, int b) {
         return r;
     }
 }
+// Whether the given operation is defined on the given integers.
+inline bool defined(BinOp op, int x, int y) {
+    return ((op != BinOp::DIV && op != BinOp::MOD) || y != 0) &&
+           (op != BinOp::POW || x != 0 || y >= 0);
+}
 }
 
 int eval(BinOp op, int x, int y) {
@@ -478,6 +483,8 @@ int eval(BinOp op, int x, int y) {
 }
 
 int Term::toNum(bool &undefined, Logger &log) {
+    int num;
+    if (evalNum(num)) { return num; }
     bool undefined_arg = false;
     Symbol y(eval(undefined_arg, log));
     if (y.type() == SymbolType::Num) {
@@ -485,7 +492,7 @@ int Term::toNum(bool &undefined, Logger &log) {
         return y.num();
     }
     else if (!undefined_arg) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
             << loc() << ": info: number expected:\n"
             << "  " << *this << "\n";
     }
@@ -520,6 +527,15 @@ UTerm wrap(UTerm &&x) {
 
 } // namespace
 
+// Evaluates the argument of an arithmetic term whose evaluation via evalNum
+// failed. Arithmetic arguments skip evalNum to not evaluate subterms twice.
+Symbol evalArg(Term const &arg, bool &undefined, Logger &log) {
+    if (auto term = dynamic_cast<BinOpTerm const *>(&arg)) { return term->evalSlow(undefined, log); }
+    if (auto term = dynamic_cast<UnOpTerm const *>(&arg)) { return term->evalSlow(undefined, log); }
+    if (auto term = dynamic_cast<LinearTerm const *>(&arg)) { return term->evalSlow(undefined, log); }
+    return arg.eval(undefined, log);
+}
+
 UTermVec unpool(UTerm const &x) {
     UTermVec pool;
     x->unpool(pool);
@@ -838,6 +854,12 @@ void ValTerm::collect(VarSet &, unsigned, unsigned) const { }
 
 Symbol ValTerm::eval(bool &, Logger &) const { return value; }
 
+bool ValTerm::evalNum(int &num) const {
+    if (value.type() != SymbolType::Num) { return false; }
+    num = value.num();
+    return true;
+}
+
 bool ValTerm::match(Symbol const &x) const { return value == x; }
 
 void ValTerm::unpool(UTermVec &x) const {
@@ -960,6 +982,12 @@ void VarTerm::collect(VarSet &vars, unsigned minLevel , unsigned maxLevel) const
 
 Symbol VarTerm::eval(bool &, Logger &) const { return *ref; }
 
+bool VarTerm::evalNum(int &num) const {
+    if (ref->type() != SymbolType::Num) { return false; }
+    num = ref->num();
+    return true;
+}
+
 bool VarTerm::match(Symbol const &x) const {
     if (bindRef) {
         *ref = x;
@@ -1066,6 +1094,12 @@ Term::ProjectRet LinearTerm::project(bool rename, AuxGen &auxGen) {
 }
 
 Symbol LinearTerm::eval(bool &undefined, Logger &log) const {
+    int num;
+    if (var->evalNum(num)) { return Symbol::createNum(m * num + n); }
+    return evalSlow(undefined, log);
+}
+
+Symbol LinearTerm::evalSlow(bool &undefined, Logger &log) const {
     bool undefined_arg = false;
     Symbol value = var->eval(undefined_arg, log);
     if (value.type() == SymbolType::Num) {
@@ -1073,7 +1107,7 @@ Symbol LinearTerm::eval(bool &undefined, Logger &log) const {
         return Symbol::createNum(m * value.num() + n);
     }
     else if (!undefined_arg) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
             << loc() << ": info: operation undefined:\n"
             << "  " << *this << "\n";
     }
@@ -1081,6 +1115,12 @@ Symbol LinearTerm::eval(bool &undefined, Logger &log) const {
     return Symbol::createNum(0);
 }
 
+bool LinearTerm::evalNum(int &num) const {
+    if (!var->evalNum(num)) { return false; }
+    num = m * num + n;
+    return true;
+}
+
 bool LinearTerm::match(Symbol const &x) const {
     if (x.type() == SymbolType::Num) {
         assert(m != 0);
@@ -1178,7 +1218,7 @@ Term::SimplifyRet UnOpTerm::simplify(SimplifyState &state, bool, bool arithmetic
     }
     else if ((multiNeg && ret.notNumeric() && ret.notFunction()) || (!multiNeg && ret.notNumeric())) {
         ret.update(arg);
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
             << loc() << ": info: operation undefined:\n"
             << "  " << *this << "\n";
         return {};
@@ -1223,8 +1263,13 @@ void UnOpTerm::collect(VarSet &vars, unsigned minLevel , unsigned maxLevel) cons
     arg->collect(vars, minLevel, maxLevel);
 }
 Symbol UnOpTerm::eval(bool &undefined, Logger &log) const {
+    int num;
+    if (arg->evalNum(num)) { return Symbol::createNum(Gringo::eval(op, num)); }
+    return evalSlow(undefined, log);
+}
+Symbol UnOpTerm::evalSlow(bool &undefined, Logger &log) const {
     bool undefined_arg = false;
-    Symbol value = arg->eval(undefined_arg, log);
+    Symbol value = evalArg(*arg, undefined_arg, log);
     if (value.type() == SymbolType::Num) {
         undefined = undefined || undefined_arg;
         int num = value.num();
@@ -1241,13 +1286,19 @@ Symbol UnOpTerm::eval(bool &undefined, Logger &log) const {
         return value.flipSign();
     }
     else if (!undefined_arg) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
             << loc() << ": info: operation undefined:\n"
             << "  " << *this << "\n";
     }
     undefined = true;
     return Symbol::createNum(0);
 }
+bool UnOpTerm::evalNum(int &num) const {
+    if (!arg->evalNum(num)) { return false; }
+    num = Gringo::eval(op, num);
+    return true;
+}
+
 bool UnOpTerm::match(Symbol const &x) const  {
     if (op != UnOp::NEG) {
         throw std::logic_error("Term::rewriteArithmetics must be called before Term::match");
@@ -1359,7 +1410,7 @@ Term::SimplifyRet BinOpTerm::simplify(SimplifyState &state, bool, bool, Logger &
     }
     else if (retLeft.notNumeric() || retRight.notNumeric() || ((op == BinOp::DIV || op == BinOp::MOD) && retRight.isZero())) {
         retLeft.update(left); retRight.update(right);
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
             << loc() << ": info: operation undefined:\n"
             << "  " << *this << "\n";
         return {};
@@ -1371,7 +1422,7 @@ Term::SimplifyRet BinOpTerm::simplify(SimplifyState &state, bool, bool, Logger &
         auto left  = retLeft.val.num();
         auto right = retRight.val.num();
         if (op == BinOp::POW && left == 0 && right < 0) {
-            GRINGO_REPORT(log, Warnings::OperationUndefined)
+            GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
                 << loc() << ": info: operation undefined:\n"
                 << "  " << *this << "\n";
             return {};
@@ -1438,20 +1489,21 @@ void BinOpTerm::collect(VarSet &vars, unsigned minLevel , unsigned maxLevel) con
 }
 
 Symbol BinOpTerm::eval(bool &undefined, Logger &log) const {
+    int num;
+    if (evalNum(num)) { return Symbol::createNum(num); }
+    return evalSlow(undefined, log);
+}
+
+Symbol BinOpTerm::evalSlow(bool &undefined, Logger &log) const {
     bool undefined_arg = false;
-    Symbol l(left->eval(undefined_arg, log));
-    Symbol r(right->eval(undefined_arg, log));
-    bool defined =
-        l.type() == SymbolType::Num &&
-        r.type() == SymbolType::Num &&
-        ((op != BinOp::DIV && op != BinOp::MOD) || r.num() != 0) &&
-        (op != BinOp::POW || l.num() != 0 || r.num() >= 0);
-    if (defined) {
+    Symbol l(evalArg(*left, undefined_arg, log));
+    Symbol r(evalArg(*right, undefined_arg, log));
+    if (l.type() == SymbolType::Num && r.type() == SymbolType::Num && defined(op, l.num(), r.num())) {
         undefined = undefined || undefined_arg;
         return Symbol::createNum(Gringo::eval(op, l.num(), r.num()));
     }
     else if (!undefined_arg) {
-        GRINGO_REPORT(log, Warnings::OperationUndefined)
+        GRINGO_REPORT_LOC(log, Warnings::OperationUndefined, loc())
             << loc() << ": info: operation undefined:\n"
             << "  " << *this << "\n";
     }
@@ -1459,6 +1511,13 @@ Symbol BinOpTerm::eval(bool &undefined, Logger &log) const {
     return Symbol::createNum(0);
 }
 
+bool BinOpTerm::evalNum(int &num) const {
+    int l, r;
+    if (!left->evalNum(l) || !right->evalNum(r) || !defined(op, l, r)) { return false; }
+    num = Gringo::eval(op, l, r);
+    return true;
+}
+
 bool BinOpTerm::match(Symbol const &) const { throw std::logic_error("Term::rewriteArithmetics must be called before Term::match"); }
 
 void BinOpTerm::unpool(UTermVec &x) const {
@@ -0,0 +1,74 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "tests/tests.hh"
+#include "tests/term_helper.hh"
+#include "gringo/output/literals.hh"
+
+namespace Gringo { namespace Test {
+
+TEST_CASE("domain", "[base]") {
+    SECTION("filter") {
+        MembershipFilter filter;
+        // an empty filter contains nothing
+        REQUIRE(!filter.mayContain(0));
+        REQUIRE(!filter.insert(0));
+        filter.reset(1);
+        size_t n = 0;
+        for (size_t i = 0; i < 10000; ++i) {
+            if (!filter.insert(i)) {
+                filter.reset(i + 1);
+                for (size_t j = 0; j <= i; ++j) { REQUIRE(filter.insert(j)); }
+            }
+            else { ++n; }
+        }
+        REQUIRE(n < 10000);
+        for (size_t i = 0; i < 10000; ++i) { REQUIRE(filter.mayContain(i)); }
+        size_t positives = 0;
+        for (size_t i = 10000; i < 20000; ++i) { positives += filter.mayContain(i); }
+        REQUIRE(positives < 500);
+        filter.clear();
+        REQUIRE(!filter.mayContain(0));
+    }
+
+    SECTION("lookup") {
+        Output::PredicateDomain dom(Sig("p", 1, false));
+        for (int i = 0; i < 50; ++i) { dom.define(FUN("p", {NUM(i)}), false); }
+        for (int i = 100; i < 150; ++i) { dom.reserve(FUN("p", {NUM(i)})); }
+        for (int i = 0; i < 150; ++i) { REQUIRE((dom.find(FUN("p", {NUM(i)})) != dom.end()) == (i < 50 || i >= 100)); }
+        REQUIRE(dom.filterStats().lookups == 150);
+        REQUIRE(dom.filterStats().rejected + dom.filterStats().misses == 50);
+        REQUIRE(dom.filterStats().rejected >= 45);
+        // reserved atoms are deleted and the filter is rebuilt
+        Output::Mapping map;
+        dom.cleanup([](unsigned) { return std::make_pair(false, Potassco::Value_t::Free); }, map);
+        dom.filterStats() = FilterStats();
+        for (int i = 0; i < 150; ++i) { REQUIRE((dom.find(FUN("p", {NUM(i)})) != dom.end()) == (i < 50)); }
+        REQUIRE(dom.filterStats().lookups == 150);
+        REQUIRE(dom.filterStats().rejected + dom.filterStats().misses == 100);
+        REQUIRE(dom.filterStats().rejected >= 90);
+    }
+}
+
+} } // namespace Test Gringo
@@ -29,6 +29,7 @@
 
 #include "tests/tests.hh"
 
+#include <cstring>
 #include <regex>
 
 namespace Gringo { namespace Ground { namespace Test {
@@ -37,17 +38,12 @@ using namespace Gringo::IO;
 
 namespace {
 
-std::string ground(std::string const &str, std::initializer_list<std::string> filter = {""}) {
-    std::regex delayedDef("^#delayed\\(([0-9]+)\\) <=> (.*)$");
-    std::regex delayedOcc("#delayed\\(([0-9]+)\\)");
-    std::map<std::string, std::string> delayedMap;
-    std::stringstream ss;
-
+std::pair<std::string, std::string> groundBase(std::string const &str, Output::OutputFormat format, bool explain, Gringo::Test::TestGringoModule &module, std::function<void (Output::OutputBase &)> inspect = nullptr) {
+    std::stringstream ss, es;
     Potassco::TheoryData td;
-    Output::OutputBase out(td, {}, ss, Output::OutputFormat::TEXT);
+    Output::OutputBase out(td, {}, ss, format);
     Input::Program prg;
     Defines defs;
-    Gringo::Test::TestGringoModule module;
     Gringo::Test::TestContext context;
     Input::NongroundProgramBuilder pb{ context, prg, out, defs };
     bool incmode;
@@ -58,8 +54,18 @@ std::string ground(std::string const &str, std::initializer_list<std::string> fi
     Program gPrg(prg.toGround({Sig{"base", 0, false}}, out.data, module));
     Parameters params;
     params.add("base", {});
-    gPrg.ground(params, context, out, module);
+    gPrg.ground(params, context, out, module, explain ? &es : nullptr);
     out.endStep({});
+    if (inspect) { inspect(out); }
+    return {ss.str(), es.str()};
+}
+
+std::string ground(std::string const &str, std::initializer_list<std::string> filter = {""}) {
+    std::regex delayedDef("^#delayed\\(([0-9]+)\\) <=> (.*)$");
+    std::regex delayedOcc("#delayed\\(([0-9]+)\\)");
+    std::map<std::string, std::string> delayedMap;
+    Gringo::Test::TestGringoModule module;
+    std::stringstream ss(groundBase(str, Output::OutputFormat::TEXT, false, module).first);
 
     std::string line;
     std::vector<std::string> res;
@@ -100,6 +106,27 @@ std::string ground(std::string const &str, std::initializer_list<std::string> fi
     return oss.str();
 }
 
+std::string explain(std::string const &str) {
+    Gringo::Test::TestGringoModule module;
+    return groundBase(str, Output::OutputFormat::TEXT, true, module).second;
+}
+
+std::string count(std::string const &str) {
+    Gringo::Test::TestGringoModule module;
+    return groundBase(str, Output::OutputFormat::COUNT, false, module).first;
+}
+
+// Returns the number of indices of the given predicate after grounding.
+size_t indices(std::string const &str, Sig sig) {
+    Gringo::Test::TestGringoModule module;
+    size_t ret = 0;
+    groundBase(str, Output::OutputFormat::TEXT, false, module, [&](Output::OutputBase &out) {
+        auto it = out.predDoms().find(sig);
+        if (it != out.predDoms().end()) { ret = (*it)->numIndices(); }
+    });
+    return ret;
+}
+
 std::string gbie() {
     return
         "char_to_digit(X,X) :- X=0..9.\n"
@@ -1128,6 +1155,144 @@ TEST_CASE("ground-instantiation", "[ground]") {
         REQUIRE("p(((),())).\n" == ground("p(((),())).\n"));
     }
 
+    SECTION("index") {
+        // small domains are scanned while large ones are indexed
+        REQUIRE(
+            "s(49,49).\n"
+            "s(49,50).\n"
+            "s(50,50).\n"
+            "s(50,51).\n"
+            "t(a).\n"
+            "t(b).\n" == ground(
+                "e(X,X;X,X+1) :- X=1..50.\n"
+                "f(1,a;1,b;2,c).\n"
+                "r(1).\n"
+                "r(Y) :- r(X), e(X,Y).\n"
+                "s(X,Y) :- r(X), e(X,Y), X > 48.\n"
+                "t(Y) :- r(X), f(X,Y), X < 2.\n", {"s(", "t("}));
+        REQUIRE(
+            "reach(1,10).\n"
+            "reach(1,11).\n"
+            "reach(1,12).\n"
+            "reach(1,2).\n"
+            "reach(1,3).\n"
+            "reach(1,4).\n"
+            "reach(1,5).\n"
+            "reach(1,6).\n"
+            "reach(1,7).\n"
+            "reach(1,8).\n"
+            "reach(1,9).\n" == ground(
+                "e(X,X+1) :- X=1..11.\n"
+                "reach(X,Y) :- e(X,Y).\n"
+                "reach(X,Z) :- e(X,Y), reach(Y,Z).\n", {"reach(1,"}));
+        // the mode of the index is printed next to the literal
+        auto small = explain(
+            "e(X,X;X,X+1) :- X=1..10.\n"
+            "r(1).\n"
+            "r(Y) :- r(X), e(X,Y).\n");
+        REQUIRE(small.find("[scan]") != std::string::npos);
+        REQUIRE(small.find("[index]") == std::string::npos);
+        auto large = explain(
+            "e(X,X;X,X+1) :- X=1..50.\n"
+            "r(1).\n"
+            "r(Y) :- r(X), e(X,Y).\n");
+        REQUIRE(large.find("[index]") != std::string::npos);
+        REQUIRE(large.find("[scan]") == std::string::npos);
+    }
+
+    SECTION("shareIndex") {
+        // equivalent occurrences of e share one index
+        REQUIRE(1 == indices(
+            "a(1;2).\n"
+            "b(1;2).\n"
+            "e(1..4,1..4).\n"
+            "p(Y) :- a(X), e(X,Y).\n"
+            "q(B) :- b(A), e(A,B).\n", Sig("e", 2, false)));
+    }
+
+    SECTION("memoize") {
+        // e(X,Y) has the smallest domain and is matched first, the subjoin
+        // f(Y,Z), g(Z,W) fails for Y=1 independently of X
+        std::string prg =
+            "e(1,1;2,1;3,1;4,1;5,2).\n"
+            "f(1,1..5;2,6).\n"
+            "g(6..11,1).\n"
+            "r(X) :- e(X,Y), f(Y,Z), g(Z,W).\n";
+        REQUIRE("r(5).\n" == ground(prg, {"r("}));
+        {
+            std::regex row("^[0-9]+\t[^\t]*\t[^\t]*\t[0-9]+\t[0-9]+\t([0-9]+)\t([0-9]+)\t.*$");
+            std::stringstream ss(explain(prg));
+            uint64_t lookups = 0, hits = 0;
+            std::string line;
+            while (std::getline(ss, line)) {
+                std::smatch m;
+                if (std::regex_match(line, m, row)) {
+                    lookups += std::stoull(m[1]);
+                    hits += std::stoull(m[2]);
+                }
+            }
+            REQUIRE(lookups == 5);
+            REQUIRE(hits == 3);
+        }
+        // failures are forgotten once new atoms are derived
+        REQUIRE(
+            "reach(1).\n"
+            "reach(2).\n"
+            "reach(3).\n"
+            "reach(4).\n"
+            "reach(5).\n" == ground(
+                "e(1..4,1..4).\n"
+                "n(1..5).\n"
+                "reach(1).\n"
+                "reach(Y) :- n(X), reach(X), e(X,Y), n(Y).\n", {"reach("}));
+    }
+
+    SECTION("explain") {
+        auto ret = explain(
+            "p(1..3).\n"
+            "r(4).\n"
+            "q(X) :- p(X), not r(X).\n");
+        REQUIRE(ret.find("pos\tkind\testimate\tmatches\tbindings\tmemo-lookups\tmemo-hits\tliteral\n") != std::string::npos);
+        REQUIRE(ret.find("\tfull-index\t") != std::string::npos);
+        REQUIRE(ret.find("\tlookup\t") != std::string::npos);
+        REQUIRE(ret.find("solutions: 3\n") != std::string::npos);
+    }
+
+    SECTION("count") {
+        auto ret = count(
+            "p(1..3).\n"
+            "{ r(1) }.\n"
+            "q(X) :- p(X), not r(X).\n"
+            "s :- #count { X : r(X) } >= 1.\n");
+        REQUIRE(ret.find("rules      : 8\n") != std::string::npos);
+        REQUIRE(ret.find("elements   : 1\n") != std::string::npos);
+        REQUIRE(ret.find("atoms      : 8\n") != std::string::npos);
+        REQUIRE(ret.find("lookups    : ") != std::string::npos);
+        REQUIRE(ret.find("filtered   : ") != std::string::npos);
+    }
+
+    SECTION("filter") {
+        auto ret = count(
+            "p(1..100).\n"
+            "blocked(1).\n"
+            "q(X) :- p(X), not blocked(X).\n");
+        auto value = [&ret](char const *label) {
+            auto pos = ret.find(label);
+            REQUIRE(pos != std::string::npos);
+            return std::stoul(ret.substr(pos + std::strlen(label)));
+        };
+        REQUIRE(value("atoms      : ") == 200);
+        // the negative literal is looked up for all 100 values of X but
+        // only blocked(1) exists; the remaining lookups are mostly answered
+        // by the filter of the domain of blocked/1
+        auto lookups = value("lookups    : ");
+        auto filtered = value("filtered   : ");
+        auto missed = value("missed     : ");
+        REQUIRE(lookups >= 100);
+        REQUIRE(filtered >= 90);
+        REQUIRE(filtered + missed < lookups);
+    }
+
 }
 
 } } } // namespace Test Ground Gringo
@@ -28,6 +28,7 @@
 #include "gringo/output/output.hh"
 #include "input/nongroundgrammar/grammar.hh"
 #include "gringo/symbol.hh"
+#include "gringo/decompress.hh"
 
 #include "tests/tests.hh"
 
@@ -104,5 +105,29 @@ TEST_CASE("input-nongroundlexer", "[input]") {
 
 // }}}
 
+#ifdef CLINGO_WITH_ZLIB
+TEST_CASE("input-decompress", "[input]") {
+    // gzip compressed "p(1).\nq(2).\n"
+    std::string gz(
+        "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x2b\xd0\x30\xd4\xd4\xe3"
+        "\x2a\xd4\x30\x02\x92\x00\x0b\xcc\x8c\x35\x0c\x00\x00\x00", 30);
+    for (bool threaded : {false, true}) {
+        std::unique_ptr<std::istream> in(new std::istringstream(gz + gz));
+        REQUIRE(isCompressed(*in));
+        auto dec = decompress(std::move(in), threaded);
+        std::ostringstream oss;
+        oss << dec->rdbuf();
+        REQUIRE(oss.str() == "p(1).\nq(2).\np(1).\nq(2).\n");
+    }
+    std::unique_ptr<std::istream> in(new std::istringstream(gz.substr(0, 20)));
+    auto dec = decompress(std::move(in), false);
+    std::string str;
+    REQUIRE_THROWS_AS(std::getline(*dec, str), std::runtime_error const &);
+    std::istringstream plain("p(1).");
+    REQUIRE(!isCompressed(plain));
+    REQUIRE(plain.get() == 'p');
+}
+#endif
+
 } } } // namespace Test Input Gringo
 
@@ -62,6 +62,31 @@ TEST_CASE("input-parse_term", "[input]") {
         REQUIRE(SUP() == m.parseValue("#sup"));
     }
 
+    SECTION("simple") {
+        TestGringoModule m;
+        REQUIRE(NUM(123456789) == m.parseValue(" 123456789 "));
+        REQUIRE(NUM(1234567890) == m.parseValue("1234567890"));
+        REQUIRE(NUM(-42) == m.parseValue("-42"));
+        REQUIRE(NUM(10) == m.parseValue("0xA"));
+        REQUIRE_THROWS_AS(m.parseValue("01"), std::runtime_error);
+        REQUIRE(ID("_x'Y") == m.parseValue("_x'Y"));
+        REQUIRE(STR("a\"b\\c\nd") == m.parseValue("\"a\\\"b\\\\c\\nd\""));
+        REQUIRE_THROWS_AS(m.parseValue("\"a\\tb\""), std::runtime_error);
+        REQUIRE(FUN("f", {NUM(1), ID("a", true), STR("s")}) == m.parseValue("f( 1 , -a,\"s\" )"));
+        REQUIRE(FUN("f", {NUM(1)}, true) == m.parseValue("-f(1)"));
+        REQUIRE(ID("f") == m.parseValue("f()"));
+        REQUIRE(FUN("f", {FUN("g", {NUM(1)})}) == m.parseValue("f(g(1))"));
+        REQUIRE_THROWS_AS(m.parseValue("f(1,)"), std::runtime_error);
+        REQUIRE(FUN("", {}) == m.parseValue("(,)"));
+        REQUIRE(NUM(1) == m.parseValue("(1)"));
+        REQUIRE(FUN("", {NUM(1)}) == m.parseValue("( 1 , )"));
+        REQUIRE(FUN("", {ID("a"), NUM(2)}) == m.parseValue("(a,2)"));
+        REQUIRE(NUM(3) == m.parseValue("(1+2)"));
+        REQUIRE_THROWS_AS(m.parseValue("f(1"), std::runtime_error);
+        REQUIRE_THROWS_AS(m.parseValue("X"), std::runtime_error);
+        REQUIRE_THROWS_AS(m.parseValue(""), std::runtime_error);
+    }
+
 }
 
 } } } // namespace Test Input Gringo
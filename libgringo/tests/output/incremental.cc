@@ -132,15 +132,14 @@ TEST_CASE("output-incremental", "[output]") {
             "4 4 p(2) 1 2\n"
             "4 4 p(3) 1 3\n"
             "0\n"
-            "1 0 1 5 0 1 4\n"
-            "1 1 1 6 0 1 5\n"
-            "4 4 q(1) 1 6\n"
+            "1 1 1 5 0 1 6\n"
+            "1 0 1 6 0 1 4\n"
+            "4 4 q(1) 1 5\n"
             "0\n"
-            "1 0 1 7 0 1 5\n"
-            "1 1 1 8 0 1 7\n"
-            "4 4 q(2) 1 8\n"
+            "1 1 1 7 0 1 8\n"
+            "1 0 1 8 0 1 6\n"
+            "4 4 q(2) 1 7\n"
             "0\n"
-            "1 0 1 9 0 1 7\n"
             "0\n" == iground(
                 "#program base."
                 "{p(1..3)}."
@@ -285,6 +284,44 @@ TEST_CASE("output-incremental", "[output]") {
                 ));
     }
 
+    SECTION("projectionFact") {
+        // the projection atom is a non-fact in the first step and derived as
+        // a fact in the second one where it must not reuse its old uid
+        std::stringstream ss(iground(
+            "#program base."
+            "{p(1..3)}."
+            "#program step(k)."
+            "p(4) :- k = 2."
+            "{q(k)} :- p(_)."
+            "#program last."));
+        std::set<unsigned> previous, current;
+        unsigned facts = 0;
+        std::string line;
+        while (std::getline(ss, line)) {
+            if (line == "0") {
+                previous.insert(current.begin(), current.end());
+                current.clear();
+                continue;
+            }
+            std::istringstream ls(line);
+            unsigned type, headType, headSize, bodyType, bodySize;
+            ls >> type;
+            if (type != 1) { continue; }
+            ls >> headType >> headSize;
+            std::vector<unsigned> heads(headSize);
+            for (auto &head : heads) { ls >> head; }
+            ls >> bodyType >> bodySize;
+            for (auto &head : heads) {
+                if (headType == 0 && headSize == 1 && bodySize == 0) {
+                    REQUIRE(previous.find(head) == previous.end());
+                    ++facts;
+                }
+                current.insert(head);
+            }
+        }
+        REQUIRE(facts == 2);
+    }
+
     SECTION("mapping") {
         Mapping m;
         m.add(1,0);
@@ -567,6 +567,20 @@ TEST_CASE("output-lparse", "[output]") {
         REQUIRE("([[c,p]],[])" == IO::to_string(solve("{p}. 1 {c:p}.")));
     }
 
+    SECTION("headCardinality") {
+        REQUIRE("([[p(1)],[p(2)],[p(3)]],[])" == IO::to_string(solve("{p(1..3)}=1.")));
+        REQUIRE("([[p(1),p(2),p(3)]],[])" == IO::to_string(solve("3{p(1..3)}.")));
+        REQUIRE("([[]],[])" == IO::to_string(solve("{p(1..3)}0.")));
+        REQUIRE("([[p(1),p(2)],[p(1),p(3)],[p(2),p(3)]],[])" == IO::to_string(solve("2{p(1..3)}2.")));
+        REQUIRE("([[],[p(1),p(2)],[p(1),p(2),p(3)],[p(1),p(3)],[p(2),p(3)]],[])" == IO::to_string(solve("{p(1..3)}!=1.")));
+        REQUIRE("([[p(1)],[p(2)]],[])" == IO::to_string(solve("q(1..2). {p(X):q(X)}=1.", {"p("})));
+        REQUIRE("([[p(1)]],[])" == IO::to_string(solve("p(1). {p(1..3)}=1.")));
+        REQUIRE("([[p(1),p(2)],[p(1),p(3)]],[])" == IO::to_string(solve("p(1). {p(1); p(2..3)}=2.")));
+        REQUIRE("([[p(a)],[q(a)]],[])" == IO::to_string(solve("{p(a); q(a)}=1.")));
+        REQUIRE("([[p(a)],[p(a),q(a)],[q(a)]],[])" == IO::to_string(solve("#count{X:p(X);X:q(X)}=1:-X=a.")));
+        REQUIRE("([[p(1),r],[p(2),r],[r]],[])" == IO::to_string(solve("{r}. r. {p(1..2)}1 :- r.")));
+    }
+
     SECTION("assign") {
         REQUIRE("([[p,q(1)],[q(0)]],[])" ==IO::to_string(solve("{p}. q(M):-M=#count{1:p}.")));
         REQUIRE("([[p,q(1)],[q(0)]],[])" ==IO::to_string(solve("{p}. q(M):-M=#sum+{1:p}.")));
@@ -193,6 +193,34 @@ TEST_CASE("symbol", "[base]") {
         REQUIRE("g(0,42,x,abc,\"\",\"xyz\",#inf,#sup,(42,a),f(42,a))" == comp);
     }
 
+    SECTION("print-string") {
+        auto toString = [](Symbol const &val) -> std::string {
+            std::ostringstream oss;
+            oss << val;
+            return oss.str();
+        };
+        SymVec extra = {
+            symbols[4].flipSign(),
+            symbols[11].flipSign(),
+            Symbol::createNum(-7),
+            Symbol::createStr("a\"b\\c\nd"),
+            Symbol::createTuple(SymSpan{nullptr, 0}),
+            Symbol::createTuple(SymSpan{symbols.data() + 3, 1}),
+            Symbol::createFun("g", SymSpan{symbols.data(), symbols.size()})
+        };
+        std::string buf = "prefix";
+        for (auto &sym : symbols) {
+            buf.resize(6);
+            sym.print(buf);
+            REQUIRE("prefix" + toString(sym) == buf);
+        }
+        for (auto &sym : extra) {
+            buf.clear();
+            sym.print(buf);
+            REQUIRE(toString(sym) == buf);
+        }
+    }
+
     SECTION("sig") {
         std::vector<char const *> names { "a", "b", "c", "d" };
         for (uint32_t i = 1; i < 1073741824; i*=2) {
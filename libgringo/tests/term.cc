@@ -282,6 +282,51 @@ TEST_CASE("term", "[base]") {
         REQUIRE("dummy:1:1: info: operation undefined:\n  (10\\0)\n" == log.messages().back());
     }
 
+    SECTION("undefined-aggregate") {
+        bool undefined = false;
+        log.logger.aggregate(true);
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE(NUM(0) == binop(BinOp::POW, val(ID("a")), val(NUM(1)))->eval(undefined, log));
+            REQUIRE(undefined);
+        }
+        REQUIRE(1 == log.messages().size());
+        REQUIRE("dummy:1:1: info: operation undefined:\n  (a**1)\n" == log.messages().back());
+        log.logger.summarize();
+        REQUIRE(2 == log.messages().size());
+        REQUIRE("info: messages repeated at the following locations:\n  dummy:1:1: 2 more times\n" == log.messages().back());
+        log.logger.summarize();
+        REQUIRE(2 == log.messages().size());
+        log.logger.enable(Warnings::OperationUndefined, false);
+        REQUIRE(NUM(0) == binop(BinOp::POW, val(ID("a")), val(NUM(1)))->eval(undefined, log));
+        REQUIRE(2 == log.messages().size());
+    }
+
+    SECTION("evalNum") {
+        auto x = var("X");
+        auto check = [&](UTerm const &term) -> std::string {
+            int num = 0;
+            bool undefined = false;
+            Symbol ret = term->eval(undefined, log);
+            if (!term->evalNum(num)) { return "fail"; }
+            REQUIRE(ret == NUM(num));
+            REQUIRE(!undefined);
+            return std::to_string(num);
+        };
+        *x->ref = NUM(3);
+        REQUIRE("7" == check(binop(BinOp::ADD, binop(BinOp::MUL, var("X"), val(NUM(2))), val(NUM(1)))));
+        REQUIRE("-1" == check(lin("X", -2, 5)));
+        REQUIRE("-3" == check(unop(UnOp::NEG, var("X"))));
+        REQUIRE("1" == check(binop(BinOp::MOD, val(NUM(10)), var("X"))));
+        REQUIRE("0" == check(binop(BinOp::POW, var("X"), val(NUM(-1)))));
+        REQUIRE("fail" == check(binop(BinOp::DIV, val(NUM(1)), val(NUM(0)))));
+        REQUIRE("fail" == check(binop(BinOp::POW, val(NUM(0)), val(NUM(-1)))));
+        REQUIRE("fail" == check(fun("f", var("X"))));
+        *x->ref = ID("a");
+        REQUIRE("fail" == check(binop(BinOp::ADD, var("X"), val(NUM(1)))));
+        REQUIRE("fail" == check(lin("X", 2, 1)));
+        REQUIRE("fail" == check(unop(UnOp::NEG, var("X"))));
+    }
+
     SECTION("project") {
         REQUIRE("(#p_p(#p),#p_p(#p),p(#P0))" == to_string(rewriteProject(fun("p", var("_")))));
         REQUIRE("(#p_p(#b(X),#p),#p_p(#b(#X0),#p),p(#X0,#P1))" == to_string(rewriteProject(fun("p", var("X"), var("_")))));
@@ -52,6 +52,22 @@ TEST_CASE("unique_vec", "[base]") {
         REQUIRE(!vec.push(6).second);
         REQUIRE(!vec.push(7).second);
     }
+    SECTION("huge-pages") {
+        bool enabled = hugePages();
+        setHugePages(true);
+        {
+            // large enough to back both the vector and the table with huge pages
+            unsigned n = 1 << 20;
+            UniqueVec<unsigned, std::hash<unsigned>, std::equal_to<unsigned>, HugePageAllocator<unsigned>> vec;
+            for (unsigned i = 0; i < n; ++i) { vec.push(i); }
+            setHugePages(false);
+            REQUIRE(vec.size() == n);
+            REQUIRE(!vec.push(n / 2).second);
+            REQUIRE( vec.push(n).second);
+            REQUIRE(vec.find(n - 1) != vec.end());
+        }
+        setHugePages(enabled);
+    }
 }
 
 } } // namespace Test Gringo
@@ -2238,11 +2238,35 @@ struct Assignment : Object<Assignment> {
         return 1;
     }
 
+    static int trailSize(lua_State *L) {
+        lua_pushinteger(L, call_c(L, clingo_assignment_trail_size, get_self(L).ass));
+        return 1;
+    }
+
+    static int trailAt(lua_State *L) {
+        auto offset = numeric_cast<uint32_t>(luaL_checkinteger(L, 2));
+        lua_pushinteger(L, call_c(L, clingo_assignment_trail_at, get_self(L).ass, offset));
+        return 1;
+    }
+
+    static int trailBegin(lua_State *L) {
+        auto level = numeric_cast<uint32_t>(luaL_checkinteger(L, 2));
+        lua_pushinteger(L, call_c(L, clingo_assignment_trail_begin, get_self(L).ass, level));
+        return 1;
+    }
+
+    static int trailEnd(lua_State *L) {
+        auto level = numeric_cast<uint32_t>(luaL_checkinteger(L, 2));
+        lua_pushinteger(L, call_c(L, clingo_assignment_trail_end, get_self(L).ass, level));
+        return 1;
+    }
+
     static int index(lua_State *L) {
         char const *name = luaL_checkstring(L, 2);
         if (strcmp(name, "is_total")       == 0) { return isTotal(L); }
         if (strcmp(name, "size")           == 0) { return size(L); }
         if (strcmp(name, "max_size")       == 0) { return max_size(L); }
+        if (strcmp(name, "trail_size")     == 0) { return trailSize(L); }
         if (strcmp(name, "has_conflict")   == 0) { return hasConflict(L); }
         if (strcmp(name, "decision_level") == 0) { return decisionLevel(L); }
         else {
@@ -2265,6 +2289,9 @@ luaL_Reg const Assignment::meta[] = {
     {"is_true", isTrue},
     {"is_false", isFalse},
     {"decision", decision},
+    {"trail_at", trailAt},
+    {"trail_begin", trailBegin},
+    {"trail_end", trailEnd},
     {nullptr, nullptr}
 };
 
@@ -2340,6 +2367,52 @@ struct PropagateInit : Object<PropagateInit> {
         return 0;
     }
 
+    // pushes a vector with the literals in the table at the given index in traversal order
+    static std::vector<clingo_literal_t> *checkLits(lua_State *L, int index) {
+        luaL_checktype(L, index, LUA_TTABLE);
+        auto lits = AnyWrap::new_<std::vector<clingo_literal_t>>(L); // +1
+        lua_pushnil(L);                                              // +1
+        while (lua_next(L, index)) {                                 // -1
+            auto lit = numeric_cast<clingo_literal_t>(luaL_checkinteger(L, -1));
+            PROTECT(lits->emplace_back(lit));
+            lua_pop(L, 1);                                           // -1
+        }
+        return lits;
+    }
+
+    static int mapLits(lua_State *L) {
+        auto &self = get_self(L);
+        auto lits = checkLits(L, 2);                                 // +1
+        PROTECT(lits->resize(2 * lits->size()));
+        size_t size = lits->size() / 2;
+        handle_c_error(L, clingo_propagate_init_solver_literals(self.init, lits->data(), size, lits->data() + size));
+        // the result table uses the same keys as the argument table
+        lua_newtable(L);                                             // +1
+        auto it = lits->begin() + size;
+        lua_pushnil(L);                                              // +1
+        while (lua_next(L, 2)) {                                     // -1
+            lua_pop(L, 1);                                           // -1
+            lua_pushvalue(L, -1);                                    // +1
+            lua_pushinteger(L, *it++);                               // +1
+            lua_rawset(L, -4);                                       // -2
+        }
+        return 1;
+    }
+
+    static int addWatches(lua_State *L) {
+        auto &self = get_self(L);
+        bool all = lua_isnone(L, 3) || lua_isnil(L, 3);
+        auto thread_id = all ? 0 : numeric_cast<uint32_t>(luaL_checkinteger(L, 3));
+        auto lits = checkLits(L, 2);                                 // +1
+        if (all) {
+            handle_c_error(L, clingo_propagate_init_add_watches(self.init, lits->data(), lits->size()));
+        }
+        else {
+            handle_c_error(L, clingo_propagate_init_add_watches_to_thread(self.init, lits->data(), lits->size(), thread_id-1));
+        }
+        return 0;
+    }
+
     static int getCheckMode(lua_State *L) {
         PropagatorCheckMode::new_(L, static_cast<clingo_propagator_check_mode>(clingo_propagate_init_get_check_mode(get_self(L).init)));
         return 1;
@@ -2398,7 +2471,9 @@ struct PropagateInit : Object<PropagateInit> {
 constexpr char const *PropagateInit::typeName;
 luaL_Reg const PropagateInit::meta[] = {
     {"solver_literal", mapLit},
+    {"solver_literals", mapLits},
     {"add_watch", addWatch},
+    {"add_watches", addWatches},
     {"set_state", setState},
     {nullptr, nullptr}
 };
@@ -37,6 +37,7 @@
 #include <vector>
 #include <memory>
 #include <forward_list>
+#include <cstring>
 #ifdef _MSC_VER
 #pragma warning (disable : 4800) // forcing value to bool 'true' or 'false'
 #endif
@@ -586,6 +587,53 @@ T pyToCpp(Reference py) {
     return ret;
 }
 
+// Provides read access to a sequence of integers.
+//
+// Objects supporting the buffer protocol with an integer format of matching
+// size and signedness (like array.array or numpy arrays) are accessed without
+// copying; any other iterable is converted element by element.
+template <class T>
+class IntBuffer {
+public:
+    IntBuffer(Reference obj) {
+        if (PyObject_CheckBuffer(obj.toPy())) {
+            if (PyObject_GetBuffer(obj.toPy(), &view_, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) { throw PyException(); }
+            if (view_.itemsize == sizeof(T) && matchesFormat(view_.format)) {
+                data_ = static_cast<T const *>(view_.buf);
+                size_ = view_.len / view_.itemsize;
+                return;
+            }
+            PyBuffer_Release(&view_);
+            view_.obj = nullptr;
+        }
+        pyToCpp(obj, vec_);
+        data_ = vec_.data();
+        size_ = vec_.size();
+    }
+    IntBuffer(IntBuffer const &) = delete;
+    IntBuffer &operator=(IntBuffer const &) = delete;
+    ~IntBuffer() {
+        if (view_.obj) { PyBuffer_Release(&view_); }
+    }
+    T const *data() const { return data_; }
+    size_t size() const { return size_; }
+    T const &operator[](size_t i) const { return data_[i]; }
+
+private:
+    // Buffers of the wrong signedness are converted element by element so
+    // that out of range values are reported instead of being reinterpreted.
+    static bool matchesFormat(char const *format) {
+        if (!format) { return !std::is_signed<T>::value; }
+        if (*format == '@' || *format == '=') { ++format; }
+        return format[0] != '\0' && format[1] == '\0' && std::strchr(std::is_signed<T>::value ? "bhilqn" : "BHILQN", format[0]) != nullptr;
+    }
+
+    Py_buffer view_ = {};
+    std::vector<T> vec_;
+    T const *data_ = nullptr;
+    size_t size_ = 0;
+};
+
 std::ostream &operator<<(std::ostream &out, Reference o) {
     return out << pyToCpp<std::string>(o.str());
 }
@@ -2530,6 +2578,20 @@ See Control.solve() for an example.)";
         }));
     }
 
+    Object tryGet() {
+        clingo_solve_result_bitset_t result;
+        bool ready;
+        handle_c_error(clingo_solve_handle_try_get(handle, &result, &ready));
+        if (!ready) { Py_RETURN_NONE; }
+        return SolveResult::construct(result);
+    }
+
+    Object fileno() {
+        int fd;
+        handle_c_error(clingo_solve_handle_notifier(handle, &fd));
+        return cppToPy(fd);
+    }
+
     Object user_statistics_(clingo_statistics_t *stats) {
         uint64_t root;
         handle_c_error(clingo_statistics_root(stats, &root));
@@ -2624,6 +2686,25 @@ Get the result of a solve call.
 
 If the search is not completed yet, the function blocks until the result is
 ready.)"},
+    {"try_get", to_function<&SolveHandle::tryGet>(), METH_NOARGS,
+R"(try_get(self) -> SolveResult or None
+
+Get the result of a solve call if it is ready.
+
+Unlike get(), this function never blocks and returns None if the result is not
+ready yet.)"},
+    {"fileno", to_function<&SolveHandle::fileno>(), METH_NOARGS,
+R"(fileno(self) -> int
+
+Get a file descriptor that becomes readable whenever the next result is ready.
+
+The descriptor stays readable until the result has been retrieved with
+try_get().  Since the handle provides this method, it can be registered
+directly with the select and selectors modules or an asyncio event loop to
+multiplex asynchronous searches.  The descriptor is owned by the handle and
+must neither be read from nor closed.
+
+Not available on windows.)"},
     {"wait", to_function<&SolveHandle::wait>(),  METH_VARARGS,
 R"(wait(self, timeout) -> None or bool
 
@@ -2900,6 +2981,30 @@ respectively.)";
         return cppToPy(clingo_assignment_is_total(assign));
     }
 
+    Object trailSize() {
+        uint32_t ret;
+        handle_c_error(clingo_assignment_trail_size(assign, &ret));
+        return cppToPy(ret);
+    }
+
+    Object trailAt(Reference offset) {
+        clingo_literal_t ret;
+        handle_c_error(clingo_assignment_trail_at(assign, pyToCpp<uint32_t>(offset), &ret));
+        return cppToPy(ret);
+    }
+
+    Object trailBegin(Reference level) {
+        uint32_t ret;
+        handle_c_error(clingo_assignment_trail_begin(assign, pyToCpp<uint32_t>(level), &ret));
+        return cppToPy(ret);
+    }
+
+    Object trailEnd(Reference level) {
+        uint32_t ret;
+        handle_c_error(clingo_assignment_trail_end(assign, pyToCpp<uint32_t>(level), &ret));
+        return cppToPy(ret);
+    }
+
     Object to_c() {
         return PyLong_FromVoidPtr(assign);
     }
@@ -2930,6 +3035,17 @@ Determine if the literal is false.)"},
     {"decision", to_function<&Assignment::decision>(), METH_O, R"(decision(self, level) -> int
 
     Return the decision literal of the given level.)"},
+    {"trail_at", to_function<&Assignment::trailAt>(), METH_O, R"(trail_at(self, offset) -> int
+
+The literal at the given position of the trail.
+
+The trail holds the assigned literals in the order they were assigned.)"},
+    {"trail_begin", to_function<&Assignment::trailBegin>(), METH_O, R"(trail_begin(self, level) -> int
+
+The position on the trail of the first literal assigned on the given level.)"},
+    {"trail_end", to_function<&Assignment::trailEnd>(), METH_O, R"(trail_end(self, level) -> int
+
+The position on the trail after the last literal assigned on the given level.)"},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -2939,6 +3055,7 @@ PyGetSetDef Assignment::tp_getset[] = {
     {(char *)"size", to_getter<&Assignment::size>(), nullptr, (char *)R"(The number of assigned literals.)", nullptr},
     {(char *)"max_size", to_getter<&Assignment::max_size>(), nullptr, (char *)R"(The maximum size of the assignment (if all literals are assigned).)", nullptr},
     {(char *)"is_total", to_getter<&Assignment::isTotal>(), nullptr, (char *)R"(Whether the assignment is total.)", nullptr},
+    {(char *)"trail_size", to_getter<&Assignment::trailSize>(), nullptr, (char *)R"(The number of literals on the trail.)", nullptr},
     {(char *)"_to_c", to_getter<&Assignment::to_c>(), nullptr, (char *)R"(An int representing the pointer to the underlying C clingo_assignment_t struct.)", nullptr},
     {nullptr, nullptr, nullptr, nullptr, nullptr}
 };
@@ -3040,6 +3157,27 @@ condition ids to solver literals.)";
         Py_RETURN_NONE;
     }
 
+    Object mapLits(Reference pyLits) {
+        IntBuffer<clingo_literal_t> lits{pyLits};
+        std::vector<clingo_literal_t> ret(lits.size());
+        handle_c_error(clingo_propagate_init_solver_literals(init, lits.data(), lits.size(), ret.data()));
+        return cppToPy(ret);
+    }
+
+    Object addWatches(Reference pyargs, Reference pykwds) {
+        static char const *kwlist[] = {"literals", "thread_id", nullptr};
+        Reference pyLits, thread_id = Py_None;
+        ParseTupleAndKeywords(pyargs, pykwds, "O|O", kwlist, pyLits, thread_id);
+        IntBuffer<clingo_literal_t> lits{pyLits};
+        if (!thread_id.is_none()) {
+            handle_c_error(clingo_propagate_init_add_watches_to_thread(init, lits.data(), lits.size(), pyToCpp<uint32_t>(thread_id)));
+        }
+        else {
+            handle_c_error(clingo_propagate_init_add_watches(init, lits.data(), lits.size()));
+        }
+        Py_RETURN_NONE;
+    }
+
     Object getCheckMode() {
         return PropagatorCheckMode::getAttr(clingo_propagate_init_get_check_mode(init));
     }
@@ -3066,10 +3204,31 @@ literal -- the literal to watch
 Keyword Arguments:
 thread_id -- id of the thread to watch the literal
              (Default: None)
+)"},
+    {"add_watches", to_function<&PropagateInit::addWatches>(), METH_KEYWORDS | METH_VARARGS, R"(add_watches(self, literals, thread_id) -> None
+
+Add watches for the given solver literals.
+
+This is equivalent to calling add_watch() for each literal.  Objects supporting
+the buffer protocol (like array.array('i', ...)) are read without copying.
+
+Arguments:
+literals -- iterable of literals to watch
+
+Keyword Arguments:
+thread_id -- id of the thread to watch the literals
+             (Default: None)
 )"},
     {"solver_literal", to_function<&PropagateInit::mapLit>(), METH_O, R"(solver_literal(self, lit) -> int
 
 Map the given program literal or condition id to its solver literal.)"},
+    {"solver_literals", to_function<&PropagateInit::mapLits>(), METH_O, R"(solver_literals(self, literals) -> [int]
+
+Map the given program literals or condition ids to their solver literals.
+
+This is equivalent to calling solver_literal() for each literal.  Objects
+supporting the buffer protocol (like array.array('i', ...)) are read without
+copying.)"},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -3132,6 +3291,30 @@ struct PropagateControl : ObjectBase<PropagateControl> {
         return addClauseOrNogood(pyargs, pykwds, false);
     }
 
+    Object addClauses(Reference pyargs, Reference pykwds) {
+        static char const *kwlist[] = {"offsets", "literals", "tag", "lock", nullptr};
+        Reference pyOffsets, pyLiterals;
+        Reference pyTag = Py_False;
+        Reference pyLock = Py_False;
+        ParseTupleAndKeywords(pyargs, pykwds, "OO|OO", kwlist, pyOffsets, pyLiterals, pyTag, pyLock);
+        IntBuffer<size_t> offsets{pyOffsets};
+        IntBuffer<clingo_literal_t> literals{pyLiterals};
+        size_t size = offsets.size() > 0 ? offsets.size() - 1 : 0;
+        for (size_t i = 0; i < size; ++i) {
+            if (offsets[i] > offsets[i + 1]) { throw std::runtime_error("offsets must be non-decreasing"); }
+        }
+        if (size > 0 && offsets[size] > literals.size()) { throw std::runtime_error("offsets out of range"); }
+        clingo_clause_type_t type = 0;
+        if (pyToCpp<bool>(pyTag))  { type |= clingo_clause_type_volatile; }
+        if (pyToCpp<bool>(pyLock)) { type |= clingo_clause_type_static; }
+        std::vector<clingo_clause_type_t> types(size, type);
+        return cppToPy(doUnblocked([this, &offsets, &literals, &types, size](){
+            bool ret;
+            handle_c_error(clingo_propagate_control_add_clauses(ctl, size, offsets.data(), literals.data(), types.data(), &ret));
+            return ret;
+        }));
+    }
+
     Object propagate() {
         return cppToPy(doUnblocked([this](){
             bool ret;
@@ -3214,6 +3397,28 @@ lock -- exclude clause from the solver's regular clause deletion policy
         (Default: False))"},
     {"add_nogood", to_function<&PropagateControl::addNogood>(), METH_KEYWORDS | METH_VARARGS, R"(add_nogood(self, clause, tag, lock) -> bool
 Equivalent to self.add_clause([-lit for lit in clause], tag, lock).)"},
+    {"add_clauses", to_function<&PropagateControl::addClauses>(), METH_KEYWORDS | METH_VARARGS, R"(add_clauses(self, offsets, literals, tag, lock) -> bool
+
+Add multiple clauses to the solver.
+
+The clauses are passed in a packed format: the i-th clause consists of the
+literals literals[offsets[i]:offsets[i+1]].  Both sequences can be objects
+supporting the buffer protocol (like array.array or numpy arrays), which are
+accessed without copying.
+
+Clauses are added in turn until adding a clause returns False, in which case
+the remaining clauses are not added.  This method returns False if the current
+propagation must be stopped.
+
+Arguments:
+offsets  -- sequence of len(clauses) + 1 offsets into literals
+literals -- sequence of solver literals of all clauses
+
+Keyword Arguments:
+tag  -- clauses apply only in the current solving step
+        (Default: False)
+lock -- exclude clauses from the solver's regular clause deletion policy
+        (Default: False))"},
     {"propagate", to_function<&PropagateControl::propagate>(), METH_NOARGS, R"(propagate(self) -> bool
 
 Propagate implied literals.)"},
@@ -3455,6 +3660,70 @@ bool observer_theory_atom_with_guard(clingo_id_t atom_id_or_zero, clingo_id_t te
     return observer_call("GroundProgramObserver::theory_atom_with_guard", "error in theory_atom_with_guard", data, "theory_atom_with_guard", cppToPy(atom_id_or_zero), cppToPy(term_id), cppRngToPy(elements, elements + size), cppToPy(operator_id), cppToPy(right_hand_side_id));
 }
 
+// Copies a C array passed to a batch observer into a python object.
+//
+// The elements are copied into a bytearray owned by python, which is then
+// wrapped into a memoryview with the given format. The underlying array is
+// reused after the callback returns but the copy can be kept. Python
+// versions without memoryview.cast get a list with the elements instead.
+template <class T>
+Object batchArray(T const *data, size_t size, char const *format) {
+#if PY_VERSION_HEX >= 0x03030000
+    Object bytes = PyByteArray_FromStringAndSize(reinterpret_cast<char const *>(data), size * sizeof(T));
+    Object view = PyMemoryView_FromObject(bytes.toPy());
+    return view.call("cast", cppToPy(format));
+#else
+    (void)format;
+    return cppRngToPy(data, data + size);
+#endif
+}
+
+template <class F>
+bool observer_batch_call(char const *loc, char const *msg, F f) {
+    PyBlock b;
+    try {
+        f();
+        return true;
+    }
+    catch(...) {
+        handle_cxx_error(loc, msg);
+        return false;
+    }
+}
+
+bool observer_rules(bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, size_t const *body_offsets, clingo_literal_t const *bodies, void *data) {
+    return observer_batch_call("GroundProgramObserver::rules", "error in rules", [&]() {
+        Reference{reinterpret_cast<PyObject*>(data)}.call("rules",
+            batchArray(choices, size, "?"),
+            batchArray(head_offsets, size + 1, "N"), batchArray(heads, head_offsets[size], "I"),
+            batchArray(body_offsets, size + 1, "N"), batchArray(bodies, body_offsets[size], "i"));
+    });
+}
+bool observer_weight_rules(bool const *choices, size_t size, size_t const *head_offsets, clingo_atom_t const *heads, clingo_weight_t const *lower_bounds, size_t const *body_offsets, clingo_weighted_literal_t const *bodies, void *data) {
+    static_assert(sizeof(clingo_weighted_literal_t) == 2 * sizeof(int32_t), "unexpected layout of weighted literals");
+    return observer_batch_call("GroundProgramObserver::weight_rules", "error in weight_rules", [&]() {
+        Reference{reinterpret_cast<PyObject*>(data)}.call("weight_rules",
+            batchArray(choices, size, "?"),
+            batchArray(head_offsets, size + 1, "N"), batchArray(heads, head_offsets[size], "I"),
+            batchArray(lower_bounds, size, "i"),
+            batchArray(body_offsets, size + 1, "N"), batchArray(reinterpret_cast<int32_t const *>(bodies), 2 * body_offsets[size], "i"));
+    });
+}
+bool observer_output_atoms(clingo_symbol_t const *symbols, clingo_atom_t const *atoms, size_t size, void *data) {
+    return observer_batch_call("GroundProgramObserver::output_atoms", "error in output_atoms", [&]() {
+        auto syms = reinterpret_cast<symbol_wrapper const *>(symbols);
+        Reference{reinterpret_cast<PyObject*>(data)}.call("output_atoms", cppRngToPy(syms, syms + size), batchArray(atoms, size, "I"));
+    });
+}
+bool observer_theory_elements(clingo_id_t const *element_ids, size_t size, size_t const *term_offsets, clingo_id_t const *terms, size_t const *condition_offsets, clingo_literal_t const *conditions, void *data) {
+    return observer_batch_call("GroundProgramObserver::theory_elements", "error in theory_elements", [&]() {
+        Reference{reinterpret_cast<PyObject*>(data)}.call("theory_elements",
+            batchArray(element_ids, size, "I"),
+            batchArray(term_offsets, size + 1, "N"), batchArray(terms, term_offsets[size], "I"),
+            batchArray(condition_offsets, size + 1, "N"), batchArray(conditions, condition_offsets[size], "i"));
+    });
+}
+
 // {{{1 wrap wrap Backend
 
 struct Backend : ObjectBase<Backend> {
@@ -3522,6 +3791,44 @@ format.)";
         Py_RETURN_NONE;
     }
 
+    Object addRules(Reference pyargs, Reference pykwds) {
+        static char const *kwlist[] = {"head_offsets", "heads", "body_offsets", "bodies", "choice", nullptr};
+        Reference pyHeadOffsets, pyHeads, pyBodyOffsets, pyBodies;
+        Reference pyChoice = Py_False;
+        ParseTupleAndKeywords(pyargs, pykwds, "OOOO|O", kwlist, pyHeadOffsets, pyHeads, pyBodyOffsets, pyBodies, pyChoice);
+        IntBuffer<size_t> headOffsets{pyHeadOffsets};
+        IntBuffer<clingo_atom_t> heads{pyHeads};
+        IntBuffer<size_t> bodyOffsets{pyBodyOffsets};
+        IntBuffer<clingo_literal_t> bodies{pyBodies};
+        size_t size = headOffsets.size() > 0 ? headOffsets.size() - 1 : 0;
+        if (bodyOffsets.size() != headOffsets.size()) {
+            throw std::runtime_error("head and body offsets must have the same length");
+        }
+        auto checkOffsets = [size](IntBuffer<size_t> const &offsets, size_t n) {
+            for (size_t i = 0; i < size; ++i) {
+                if (offsets[i] > offsets[i + 1]) { throw std::runtime_error("offsets must be non-decreasing"); }
+            }
+            if (size > 0 && offsets[size] > n) { throw std::runtime_error("offsets out of range"); }
+        };
+        checkOffsets(headOffsets, heads.size());
+        checkOffsets(bodyOffsets, bodies.size());
+        std::unique_ptr<bool[]> choices;
+        if (PyBool_Check(pyChoice.toPy())) {
+            if (pyChoice.isTrue()) {
+                choices.reset(new bool[size]);
+                std::fill_n(choices.get(), size, true);
+            }
+        }
+        else {
+            auto vec = pyToCpp<std::vector<bool>>(pyChoice);
+            if (vec.size() != size) { throw std::runtime_error("one choice flag per rule expected"); }
+            choices.reset(new bool[size]);
+            std::copy(vec.begin(), vec.end(), choices.get());
+        }
+        handle_c_error(clingo_backend_rules(backend, choices.get(), size, headOffsets.data(), heads.data(), bodyOffsets.data(), bodies.data()));
+        Py_RETURN_NONE;
+    }
+
     Object addExternal(Reference pyargs, Reference pykwds) {
         static char const *kwlist[] = {"head", "value", nullptr};
         Reference pyAtom = Py_None;
@@ -3620,6 +3927,35 @@ choice -- whether to add a disjunctive or choice rule (Default: False)
 
 Integrity constraints and normal rules can be added by using an empty or
 singleton head list, respectively.)"},
+    // add_rules
+    {"add_rules", to_function<&Backend::addRules>(), METH_VARARGS | METH_KEYWORDS,
+R"(add_rules(self, head_offsets, heads, body_offsets, bodies, choice) -> None
+
+Add many disjuntive or choice rules to the program at once.
+
+The rules are given in a packed format: the head of the i-th rule consists of
+heads[head_offsets[i]:head_offsets[i+1]] and its body of
+bodies[body_offsets[i]:body_offsets[i+1]]. Both offset sequences have one more
+element than there are rules.
+
+Arguments:
+head_offsets -- sequence of offsets into heads
+heads        -- sequence of program atoms
+body_offsets -- sequence of offsets into bodies
+bodies       -- sequence of program literals
+
+Keyword Arguments:
+choice -- whether to add disjunctive or choice rules; either a Boolean for all
+          rules or a sequence with one Boolean per rule (Default: False)
+
+Integer sequences supporting the buffer protocol, like array.array or numpy
+arrays of matching item size, are read without copying.
+
+Example:
+
+# adds the rules a :- not b. and b :- not a. for atoms a=1 and b=2
+backend.add_rules([0, 1, 2], [1, 2], [0, 1, 2], [-2, -1])
+)"},
     // add_weight_rule
     {"add_weight_rule", to_function<&Backend::addWeightRule>(), METH_VARARGS | METH_KEYWORDS,
 R"(add_weight_rule(self, head, lower, body, choice) -> None
@@ -6426,9 +6762,9 @@ active; you must not call any member function during search.)";
     }
     Object registerObserver(Reference args, Reference kwds) {
         CHECK_BLOCKED("register_observer");
-        static char const *kwlist[] = {"observer", "replace", nullptr};
-        Reference obs, rep = Py_False;
-        ParseTupleAndKeywords(args, kwds, "O|O", kwlist, obs, rep);
+        static char const *kwlist[] = {"observer", "replace", "batch_size", nullptr};
+        Reference obs, rep = Py_False, pyBatchSize = Py_None;
+        ParseTupleAndKeywords(args, kwds, "O|OO", kwlist, obs, rep, pyBatchSize);
         static clingo_ground_program_observer_t observer = {
             observer_init_program,
             observer_begin_step,
@@ -6453,7 +6789,18 @@ active; you must not call any member function during search.)";
         };
 
         observers.emplace_back(obs);
-        handle_c_error(clingo_control_register_observer(ctl, &observer, rep.isTrue(), obs.toPy()));
+        if (pyBatchSize.is_none()) {
+            handle_c_error(clingo_control_register_observer(ctl, &observer, rep.isTrue(), obs.toPy()));
+        }
+        else {
+            clingo_ground_program_batch_observer_t batch = {
+                obs.hasAttr("rules") ? observer_rules : nullptr,
+                obs.hasAttr("weight_rules") ? observer_weight_rules : nullptr,
+                obs.hasAttr("output_atoms") ? observer_output_atoms : nullptr,
+                obs.hasAttr("theory_elements") ? observer_theory_elements : nullptr
+            };
+            handle_c_error(clingo_control_register_batch_observer(ctl, &observer, &batch, pyToCpp<size_t>(pyBatchSize), rep.isTrue(), obs.toPy()));
+        }
         return None();
     }
     Object interrupt() {
@@ -6735,7 +7082,7 @@ Expected Answer Sets:
 a b
 a)"},
     {"register_observer", to_function<&ControlWrap::registerObserver>(), METH_VARARGS | METH_KEYWORDS,
-R"(register_observer(self, observer, replace) -> None
+R"(register_observer(self, observer, replace, batch_size) -> None
 
 Registers the given observer to inspect the produced grounding.
 
@@ -6743,9 +7090,14 @@ Arguments:
 observer -- the observer to register
 
 Keyword Arguments:
-replace  -- if set to true, the output is just passed to the observer and no
-            longer to the underlying solver
-            (Default: False)
+replace    -- if set to true, the output is just passed to the observer and no
+              longer to the underlying solver
+              (Default: False)
+batch_size -- if set, rules, weight rules, shown atoms, and theory elements are
+              passed in batches of up to the given size to the functions
+              rules, weight_rules, output_atoms, and theory_elements if the
+              observer implements them
+              (Default: None)
 
 An observer should be a class of the form below. Not all functions have to be
 implemented and can be omitted if not needed.
@@ -6909,7 +7261,55 @@ class GroundProgramObserver:
     end_step(self) -> None
         Marks the end of a block of directives passed to the solver.
 
-        This function is called right before solving starts.)"},
+        This function is called right before solving starts.
+
+If a batch size is given, the functions below receive statements in packed
+form: the i-th statement consists of the elements between offsets[i] and
+offsets[i+1] of the respective sequences.  The sequences are memoryviews
+holding a copy of the grounder's buffers and can be kept after the call
+(e.g., to be wrapped with numpy.frombuffer()).  Batches are passed on before
+any other function of the observer is called.
+
+    rules(self, choices, head_offsets, heads, body_offsets, bodies) -> None
+        Observe a batch of rules passed to the solver.
+
+        Arguments:
+        choices      -- whether the heads are choices or disjunctions
+        head_offsets -- offsets of the heads
+        heads        -- program atoms of all heads
+        body_offsets -- offsets of the bodies
+        bodies       -- program literals of all bodies
+
+    weight_rules(self, choices, head_offsets, heads, lower_bounds,
+                 body_offsets, bodies) -> None
+        Observe a batch of weight rules passed to the solver.
+
+        Arguments:
+        choices      -- whether the heads are choices or disjunctions
+        head_offsets -- offsets of the heads
+        heads        -- program atoms of all heads
+        lower_bounds -- lower bounds of the weight rules
+        body_offsets -- offsets of the bodies
+        bodies       -- flat sequence of alternating literals and weights
+                        (the i-th body starts at 2*body_offsets[i])
+
+    output_atoms(self, symbols, atoms) -> None
+        Observe a batch of shown atoms passed to the solver.
+
+        Arguments:
+        symbols -- list of symbolic representations of the atoms
+        atoms   -- the program atoms (0 for facts)
+
+    theory_elements(self, element_ids, term_offsets, terms,
+                    condition_offsets, conditions) -> None
+        Observe a batch of theory elements.
+
+        Arguments:
+        element_ids       -- ids of the elements
+        term_offsets      -- offsets of the term tuples
+        terms             -- term ids of all elements
+        condition_offsets -- offsets of the conditions
+        conditions        -- program literals of all conditions)"},
     {"register_propagator", to_function<&ControlWrap::registerPropagator>(), METH_O,
 R"(register_propagator(self, propagator) -> None
 
@@ -7326,6 +7726,21 @@ Object parseTerm(Reference args, Reference kwds) {
     return Symbol::construct(sym);
 }
 
+Object parseTerms(Reference args, Reference kwds) {
+    static char const *kwlist[] = {"strings", "logger", "message_limit", nullptr};
+    Reference pyStrs;
+    Reference logger = Py_None;
+    int message_limit = 20;
+    ParseTupleAndKeywords(args, kwds, "O|Oi", kwlist, pyStrs, logger, message_limit);
+    auto strs = pyToCpp<std::vector<std::string>>(pyStrs);
+    std::vector<char const *> cStrs;
+    cStrs.reserve(strs.size());
+    for (auto &str : strs) { cStrs.emplace_back(str.c_str()); }
+    std::vector<symbol_wrapper> syms(strs.size());
+    handle_c_error(clingo_parse_terms(cStrs.data(), cStrs.size(), !logger.is_none() ? logger_callback : nullptr, logger.toPy(), message_limit, reinterpret_cast<clingo_symbol_t*>(syms.data())));
+    return cppToPy(syms);
+}
+
 Object clingoMain(Reference args, Reference kwds) {
     Reference pyApp;
     Reference pyArgs;
@@ -7727,6 +8142,28 @@ message_limit -- maximum number of messages passed to the logger (default: 20)
 Example:
 
 clingo.parse_term('p(1+2)') == clingo.Function("p", [3])
+)"},
+    {"parse_terms", to_function<parseTerms>(), METH_VARARGS | METH_KEYWORDS,
+R"(parse_terms(strings, logger, message_limit) -> [Symbol]
+
+Parse a list of strings using gringo's term parser for ground terms.
+
+This function behaves like calling parse_term() for each string but reuses
+the same parser for all of them. Simple terms like numbers, constants, strings,
+and flat functions or tuples over these are parsed without going through the
+full term grammar.
+
+Arguments:
+strings -- the list of strings to be parsed
+
+Keyword Arguments:
+logger        -- function to intercept messages normally printed to standard
+                 error (default: None)
+message_limit -- maximum number of messages passed to the logger (default: 20)
+
+Example:
+
+clingo.parse_terms(['p(1)', '"x"']) == [clingo.Function("p", [1]), clingo.String("x")]
 )"},
     {"clingo_main", to_function<clingoMain>(), METH_VARARGS | METH_KEYWORDS,
 R"(clingo_main(application, files) -> int
@@ -7870,6 +8307,7 @@ Function()      -- create a function symbol
 Number()        -- create a number symbol
 parse_program() -- parse a logic program
 parse_term()    -- parse ground terms
+parse_terms()   -- parse a list of ground terms
 String()        -- create a string symbol
 Tuple()         -- create a tuple symbol (shortcut)
 